@@ -33,6 +33,199 @@ protected:
 
 // ====================================================================
 
+// an event that never ends by itself (to measure the cost of the clocks only)
+class BenchmarkEvent : public chaos::ClockEvent
+{
+public:
+
+	virtual chaos::ClockEventTickResult Tick(chaos::ClockEventTickData const & tick_data) override
+	{
+		return ContinueExecution();
+	}
+};
+
+// the previous backend : every tick, all events are checked and the ones to tick are sorted in a std::set
+// (a std::multiset here : the std::set used to collapse the events with the same start time into a single one)
+class LegacyClock
+{
+public:
+
+	/** register an event */
+	void AddPendingEvent(chaos::ClockEvent * clock_event, chaos::ClockEventInfo const & event_info)
+	{
+		clock_event->GetEventInfo() = event_info;
+		pending_events.push_back(clock_event);
+	}
+
+	/** tick the events the way the previous Clock::TickClock(...) did */
+	void TickClock(float delta_time)
+	{
+		double time1 = clock_time;
+		double time2 = clock_time + double(delta_time);
+
+		clock_time = time2;
+
+		std::multiset<chaos::ClockEventTickRegistration, chaos::ClockEventTickSort> event_tick_set;
+		for (size_t i = 0; i < pending_events.size(); ++i)
+		{
+			chaos::ClockEventInfo const & event_info = pending_events[i]->GetEventInfo();
+
+			if (event_info.IsTooLateFor(time1))
+			{
+				RemoveEvent(i--);
+			}
+			else
+			{
+				chaos::ClockEventTickData execution_info = event_info.GetExecutionInfo(time1, time2);
+				if (execution_info.IsValid())
+				{
+					chaos::ClockEventTickRegistration registration;
+					registration.clock_event = pending_events[i];
+					registration.time_slice = execution_info.time_slice;
+					registration.execution_range = execution_info.execution_range;
+					registration.tick_range = execution_info.tick_range;
+					registration.abs_time_to_start = (registration.tick_range.first <= time1) ? 0.0 : registration.tick_range.first - time1;
+
+					event_tick_set.insert(registration);
+				}
+			}
+		}
+
+		for (chaos::ClockEventTickRegistration const & registration : event_tick_set)
+			TriggerClockEvent(registration);
+	}
+
+protected:
+
+	/** tick an event and prepare its repetition */
+	void TriggerClockEvent(chaos::ClockEventTickRegistration const & registration)
+	{
+		chaos::ClockEventTickResult tick_result = registration.clock_event->Tick(registration);
+
+		chaos::ClockEventInfo & event_info = registration.clock_event->GetEventInfo();
+
+		bool execution_completed = tick_result.IsExecutionCompleted() || (registration.time_slice.second >= registration.execution_range.second);
+		if (!execution_completed)
+			return;
+
+		if (!tick_result.CanRepeatExecution() || !event_info.IsRepeated() || event_info.repetition_count == 0)
+		{
+			auto it = std::find(pending_events.begin(), pending_events.end(), registration.clock_event);
+			if (it != pending_events.end())
+				RemoveEvent(size_t(it - pending_events.begin()));
+			return;
+		}
+		if (!event_info.IsRepeatedInfinitly())
+			event_info.repetition_count--;
+		event_info.start_time = std::min(registration.tick_range.second, registration.time_slice.second) + event_info.repetition_delay;
+	}
+
+	/** remove an event (swap with the last one) */
+	void RemoveEvent(size_t index)
+	{
+		pending_events[index] = pending_events.back();
+		pending_events.pop_back();
+	}
+
+protected:
+
+	/** the time of the clock */
+	double clock_time = 0.0;
+	/** the events */
+	std::vector<chaos::shared_ptr<chaos::ClockEvent>> pending_events;
+};
+
+// the kinds of events of the benchmark
+enum class BenchmarkEventKind : int
+{
+	DORMANT,   // their start times are never reached during the measure
+	ACTIVE,    // started immediately and never completed
+	REPEATED   // single ticks repeated every second (each tick, a few of them are triggered, the others wait for their next repetition)
+};
+
+static chaos::ClockEventInfo GetBenchmarkEventInfo(BenchmarkEventKind kind, size_t index, size_t event_count)
+{
+	switch (kind)
+	{
+	case BenchmarkEventKind::DORMANT:
+		return chaos::ClockEventInfo::ForeverEvent(1000000.0 + double(index));
+	case BenchmarkEventKind::ACTIVE:
+		return chaos::ClockEventInfo::ForeverEvent(0.0);
+	default:
+		return chaos::ClockEventInfo::SingleTickEvent(double(index) / double(event_count), chaos::ClockEventRepetitionInfo::InfiniteRepetition(1.0));
+	}
+}
+
+static char const * GetBenchmarkEventKindName(BenchmarkEventKind kind)
+{
+	switch (kind)
+	{
+	case BenchmarkEventKind::DORMANT:
+		return "dormant";
+	case BenchmarkEventKind::ACTIVE:
+		return "active";
+	default:
+		return "repeated";
+	}
+}
+
+// measure the average duration of a tick (in microseconds)
+template<typename CLOCK>
+static double MeasureClockTicks(CLOCK * clock, size_t tick_count)
+{
+	float delta_time = 1.0f / 60.0f;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < tick_count; ++i)
+		clock->TickClock(delta_time);
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / double(tick_count);
+}
+
+// compare the cost of a clock having many events of the same kind with the previous backend
+static std::string BenchmarkClockEvents(BenchmarkEventKind kind, size_t event_count)
+{
+	size_t tick_count = std::max(size_t(10), size_t(6000000) / event_count); // the previous backend is far too slow with many events
+
+	std::vector<chaos::shared_ptr<chaos::ClockEvent>> events;
+	events.reserve(event_count);
+
+	// the heap backend
+	chaos::shared_ptr<chaos::Clock> clock = new chaos::Clock("benchmark");
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < event_count; ++i)
+	{
+		chaos::shared_ptr<chaos::ClockEvent> clock_event = new BenchmarkEvent;
+		if (clock->AddPendingEvent(clock_event.get(), GetBenchmarkEventInfo(kind, i, event_count), false))
+			events.push_back(clock_event);
+	}
+	double add_duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / double(event_count);
+
+	double tick_duration = MeasureClockTicks(clock.get(), tick_count);
+
+	std::shuffle(events.begin(), events.end(), std::mt19937(12345)); // remove from anywhere in the heap rather than always its last element
+
+	start = std::chrono::steady_clock::now();
+	for (chaos::shared_ptr<chaos::ClockEvent> & clock_event : events)
+		clock_event->RemoveFromClock();
+	double remove_duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / double(event_count);
+	events.clear();
+
+	// the std::set backend
+	double legacy_tick_duration = 0.0;
+	{
+		LegacyClock legacy_clock;
+		for (size_t i = 0; i < event_count; ++i)
+			legacy_clock.AddPendingEvent(new BenchmarkEvent, GetBenchmarkEventInfo(kind, i, event_count));
+		legacy_tick_duration = MeasureClockTicks(&legacy_clock, tick_count);
+	}
+
+	return chaos::StringTools::Printf("events: %d %s | tick (us) : heap %f, std::set %f | add %f ns | remove %f ns",
+		int(event_count), GetBenchmarkEventKindName(kind), tick_duration, legacy_tick_duration, add_duration, remove_duration);
+}
+
+// ====================================================================
+
 static glm::vec4 const red = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
 static glm::vec4 const green = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
 static glm::vec4 const blue = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
@@ -76,6 +269,7 @@ protected:
 		debug_display.AddLine("Press Z to generate an Event on Clock 2 : RangeEvent");
 		debug_display.AddLine("Press E to generate an Event on Clock 3 : Forever Event");
 		debug_display.AddLine("Press T to pause");
+		debug_display.AddLine("Press B to benchmark the clock events");
 	}
 
 	void PrepareObjectProgram(chaos::GPUProgramProvider & uniform_provider, RenderingContext const & ctx, PrimitiveRenderingContext const & prim_ctx)
@@ -324,6 +518,19 @@ protected:
 				clock->Toggle();
 			return true;
 		}
+		else if (event.IsKeyReleased(chaos::KeyboardButton::B))
+		{
+			for (BenchmarkEventKind kind : { BenchmarkEventKind::DORMANT, BenchmarkEventKind::ACTIVE, BenchmarkEventKind::REPEATED })
+			{
+				for (size_t event_count : { 10000, 100000, 1000000 })
+				{
+					std::string result = BenchmarkClockEvents(kind, event_count);
+					chaos::Log::Message("%s", result.c_str());
+					debug_display.AddLine(result.c_str(), 10.0f);
+				}
+			}
+			return true;
+		}
 		else
 		{
 			if (UpdateClockTimeScaleWithKeys(clock1.get(), event, chaos::KeyboardButton::KP_1, chaos::KeyboardButton::KP_2))
@@ -33,6 +33,8 @@ public:
 	chaos::Key scale_object_negative_y = chaos::KeyboardLayoutConversion::ConvertKey("A", chaos::KeyboardLayoutType::AZERTY);
 	chaos::Key scale_object_positive_z = chaos::KeyboardLayoutConversion::ConvertKey("S", chaos::KeyboardLayoutType::AZERTY);
 	chaos::Key scale_object_negative_z = chaos::KeyboardLayoutConversion::ConvertKey("Z", chaos::KeyboardLayoutType::AZERTY);
+
+	chaos::Key broad_phase_benchmark = chaos::KeyboardLayoutConversion::ConvertKey("B", chaos::KeyboardLayoutType::AZERTY);
 };
 
 // =======================================================================
@@ -69,6 +71,113 @@ public:
 	std::vector<class GeometricObject*> objects;
 };
 
+// =======================================================================
+// BroadPhaseBenchmark : TMObjectBroadPhase compared with the scan over all objects
+//                       that the trigger collisions were using
+// =======================================================================
+
+class BroadPhaseBenchmarkObject : public chaos::TMObject
+{
+public:
+
+	/** override (there is no layer instance, so there is no layer offset) */
+	virtual chaos::box2 GetBoundingBox(bool world_system) const override
+	{
+		return bounding_box;
+	}
+};
+
+class BroadPhaseBenchmark
+{
+public:
+
+	static double GetElapsedMilliseconds(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	static chaos::box2 GetRandomBox(float world_size, float min_size, float max_size)
+	{
+		chaos::box2 result;
+		result.position = { chaos::MathTools::RandFloat(-world_size, world_size), chaos::MathTools::RandFloat(-world_size, world_size) };
+		result.half_size = { chaos::MathTools::RandFloat(min_size, max_size), chaos::MathTools::RandFloat(min_size, max_size) };
+		return result;
+	}
+
+	static void Run(size_t object_count, size_t query_count)
+	{
+		static constexpr float WORLD_SIZE = 20000.0f;
+
+		// a level like scene : objects (triggers) spread over a large area, queried by pawn/camera sized boxes
+		std::vector<chaos::shared_ptr<BroadPhaseBenchmarkObject>> objects;
+		for (size_t i = 0; i < object_count; ++i)
+		{
+			BroadPhaseBenchmarkObject* object = new BroadPhaseBenchmarkObject;
+			object->SetBoundingBox(GetRandomBox(WORLD_SIZE, 8.0f, 64.0f));
+			objects.push_back(object);
+		}
+
+		std::vector<chaos::box2> queries;
+		for (size_t i = 0; i < query_count; ++i)
+			queries.push_back(GetRandomBox(WORLD_SIZE, 16.0f, 256.0f));
+
+		// the linear scan
+		size_t linear_hits = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (chaos::box2 const& query : queries)
+			for (auto const& object : objects)
+				if (chaos::Collide(query, object->GetBoundingBox(true), true))
+					++linear_hits;
+		double linear_duration = GetElapsedMilliseconds(start);
+
+		// the construction of the broad phase
+		chaos::TMObjectBroadPhase broad_phase;
+
+		start = std::chrono::steady_clock::now();
+		for (auto const& object : objects)
+			broad_phase.InsertObject(object.get());
+		double build_duration = GetElapsedMilliseconds(start);
+
+		// the queries (the collision mask is 0 because the objects have no layer)
+		size_t tree_hits = 0;
+		std::vector<chaos::TMObject*> candidates;
+		start = std::chrono::steady_clock::now();
+		for (chaos::box2 const& query : queries)
+		{
+			candidates.clear();
+			broad_phase.CollectObjects(query, 0, true, candidates);
+			tree_hits += candidates.size();
+		}
+		double query_duration = GetElapsedMilliseconds(start);
+
+		// a tick where all objects move a little (the node only changes when necessary)
+		for (auto const& object : objects)
+		{
+			chaos::box2 box = object->GetBoundingBox(true);
+			box.position += glm::vec2(chaos::MathTools::RandFloat(-4.0f, 4.0f), chaos::MathTools::RandFloat(-4.0f, 4.0f));
+			object->SetBoundingBox(box);
+		}
+		start = std::chrono::steady_clock::now();
+		broad_phase.UpdateAllObjects();
+		double update_duration = GetElapsedMilliseconds(start);
+
+		// the removal of half the objects (as for objects destroyed during the game)
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < object_count; i += 2)
+			broad_phase.RemoveObject(objects[i].get());
+		double remove_duration = GetElapsedMilliseconds(start);
+
+		chaos::Log::Message("BroadPhaseBenchmark [%d objects, %d queries] linear scan: %f ms | build: %f ms, queries: %f ms, update: %f ms, remove half: %f ms (%d remaining) | hits: %d / %d",
+			int(object_count), int(query_count), linear_duration, build_duration, query_duration, update_duration, remove_duration, int(broad_phase.GetObjectCount()), int(linear_hits), int(tree_hits));
+	}
+
+	static void Run()
+	{
+		for (size_t object_count : {100, 1000, 10000, 100000})
+			Run(object_count, 1000);
+	}
+};
+
 // =======================================================================
 
 class GeometricObject : public chaos::Object
@@ -280,6 +389,7 @@ protected:
 			DrawTextItem("next object", key_configuration.next_object, enabled);
 			DrawTextItem("previous object", key_configuration.previous_object, enabled);
 			DrawTextItem("delete object", key_configuration.delete_object, enabled);
+			DrawTextItem("broad phase benchmark (log)", key_configuration.broad_phase_benchmark, true);
 
 			if (current_action_type == ActionType::MOVE_OBJECT)
 			{
@@ -596,6 +706,13 @@ protected:
 
 	virtual bool OnKeyEventImpl(chaos::KeyEvent const& event) override
 	{
+		// compare the broad phase with a linear scan
+		if (event.IsKeyPressed(key_configuration.broad_phase_benchmark.GetKeyboardButton()))
+		{
+			BroadPhaseBenchmark::Run();
+			return true;
+		}
+
 		// change the current object if any
 		if (GeometricObject* current_object = GetCurrentGeometricObject())
 		{
@@ -0,0 +1,123 @@
+#include "chaos/Chaos.h"
+
+// write a random image file (its size and its color depend on the seed)
+static bool GenerateImageFile(boost::filesystem::path const & path, unsigned int seed)
+{
+	std::mt19937 random_generator(seed);
+
+	int width = 8 * (1 + int(random_generator() % 16));
+	int height = 8 * (1 + int(random_generator() % 16));
+
+	FIBITMAP * bitmap = FreeImage_Allocate(width, height, 32);
+	if (bitmap == nullptr)
+		return false;
+
+	glm::vec4 color = glm::vec4(float(random_generator() % 256) / 255.0f, float(random_generator() % 256) / 255.0f, float(random_generator() % 256) / 255.0f, 1.0f);
+	chaos::ImageDescription image_description = chaos::ImageTools::GetImageDescription(bitmap);
+	chaos::ImageTools::FillImageBackground(image_description, color);
+
+	bool result = (FreeImage_Save(FIF_PNG, bitmap, path.string().c_str(), 0) != 0);
+	FreeImage_Unload(bitmap);
+	return result;
+}
+
+// count the files in a directory (the processed images of the cache)
+static size_t CountFiles(boost::filesystem::path const & directory)
+{
+	size_t result = 0;
+	boost::system::error_code error_code;
+	for (boost::filesystem::directory_iterator it(directory, error_code), end; !error_code && it != end; ++it)
+		++result;
+	return result;
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	/** generate the atlas and returns the duration (milliseconds) */
+	double MeasureGeneration(boost::filesystem::path const & images_directory, boost::filesystem::path const & atlas_path)
+	{
+		chaos::BitmapAtlas::AtlasGeneratorParams params = chaos::BitmapAtlas::AtlasGeneratorParams(1024, 1024, 2, chaos::PixelFormatMergeParams());
+
+		auto start = std::chrono::steady_clock::now();
+		if (!chaos::BitmapAtlas::AtlasGenerator::CreateAtlasFromDirectory(images_directory, atlas_path, false, params))
+			std::cout << "failed to generate " << atlas_path.string() << std::endl;
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void BenchmarkBuildCache(boost::filesystem::path const & directory, size_t image_count)
+	{
+		boost::filesystem::path images_directory = directory / "Images";
+		boost::filesystem::path atlas_path = directory / "Atlas" / "MyAtlas.json";
+
+		boost::filesystem::path cache_images_directory = atlas_path;
+		cache_images_directory.replace_extension("atlas_cache_images");
+
+		boost::system::error_code error_code;
+		boost::filesystem::remove_all(directory, error_code);
+		boost::filesystem::create_directories(images_directory, error_code);
+		boost::filesystem::create_directories(atlas_path.parent_path(), error_code);
+		if (error_code)
+		{
+			std::cout << "failed to create " << directory.string() << std::endl;
+			return;
+		}
+
+		for (size_t i = 0; i < image_count; ++i)
+		{
+			if (!GenerateImageFile(images_directory / chaos::StringTools::Printf("image_%d.png", int(i)), (unsigned int)i))
+			{
+				std::cout << "failed to generate the images in " << images_directory.string() << std::endl;
+				return;
+			}
+		}
+
+		// the first generation decodes every file and creates the cache
+		double cold_duration = MeasureGeneration(images_directory, atlas_path);
+		// nothing changed : the sources are read from the cache and no page is saved
+		double warm_duration = MeasureGeneration(images_directory, atlas_path);
+
+		// one file modified : only its page is saved again
+		GenerateImageFile(images_directory / "image_0.png", (unsigned int)image_count);
+		double modified_duration = MeasureGeneration(images_directory, atlas_path);
+
+		// half the files removed : their processed images are pruned from the cache
+		size_t cached_files_before = CountFiles(cache_images_directory);
+		for (size_t i = 0; i < image_count; i += 2)
+			boost::filesystem::remove(images_directory / chaos::StringTools::Printf("image_%d.png", int(i)), error_code);
+		double removed_duration = MeasureGeneration(images_directory, atlas_path);
+		size_t cached_files_after = CountFiles(cache_images_directory);
+
+		std::cout << "images: " << image_count
+			<< " | cold cache: " << cold_duration << " ms"
+			<< " | warm cache: " << warm_duration << " ms"
+			<< " | 1 file modified: " << modified_duration << " ms"
+			<< " | half files removed: " << removed_duration << " ms"
+			<< " (cached images: " << cached_files_before << " -> " << cached_files_after << ")" << std::endl;
+
+		boost::filesystem::remove_all(directory, error_code);
+	}
+
+	virtual int Main() override
+	{
+		chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+		boost::filesystem::path directory;
+		if (chaos::FileTools::CreateTemporaryDirectory("AtlasBuildCacheBenchmark", directory))
+		{
+			BenchmarkBuildCache(directory / "100", 100);
+			BenchmarkBuildCache(directory / "1000", 1000);
+			BenchmarkBuildCache(directory / "4000", 4000);
+		}
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,112 @@
+#include "chaos/Chaos.h"
+
+static int ATLAS_PADDING = 2;
+
+// add a plain bitmap to the folder (its size depends on the random generator)
+static bool AddFakeBitmap(chaos::BitmapAtlas::FolderInfoInput * folder_input, char const * name, std::mt19937 & random_generator)
+{
+	assert(name != nullptr);
+
+	// mix of small and large bitmaps, with various aspect ratios
+	int w = 4 * (1 + int(random_generator() % 32));
+	int h = 4 * (1 + int(random_generator() % 32));
+	if (random_generator() % 8 == 0)
+		w *= 3;
+	if (random_generator() % 8 == 0)
+		h *= 3;
+
+	FIBITMAP * bitmap = FreeImage_Allocate(w, h, 32);
+	if (bitmap == nullptr)
+		return false;
+
+	float color = float(random_generator() % 256) / 255.0f;
+
+	chaos::ImageDescription image_description = chaos::ImageTools::GetImageDescription(bitmap);
+	chaos::ImageTools::FillImageBackground(image_description, glm::vec4(color, color, color, 1.0f));
+
+	if (folder_input->AddBitmap(bitmap, true, name, 0) == nullptr)
+	{
+		FreeImage_Unload(bitmap);
+		return false;
+	}
+	return true;
+}
+
+// the ratio of the pages surface covered by the bitmaps
+static float ComputeFillRatio(chaos::BitmapAtlas::Atlas const & atlas)
+{
+	glm::ivec2 dimension = atlas.GetAtlasDimension();
+
+	float pages_surface = float(atlas.GetBitmapCount()) * float(dimension.x) * float(dimension.y);
+	if (pages_surface <= 0.0f)
+		return 0.0f;
+	return atlas.ComputeSurface(-1) / pages_surface;
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	void BenchmarkPackingAlgorithms(int bitmap_count)
+	{
+		std::pair<chaos::BitmapAtlas::AtlasPackingAlgorithm, char const *> algorithms[] =
+		{
+			{ chaos::BitmapAtlas::AtlasPackingAlgorithm::CORNERS, "CORNERS" },
+			{ chaos::BitmapAtlas::AtlasPackingAlgorithm::SKYLINE, "SKYLINE" },
+			{ chaos::BitmapAtlas::AtlasPackingAlgorithm::MAX_RECTS, "MAX_RECTS" }
+		};
+
+		// the same bitmaps for all algorithms
+		std::mt19937 random_generator(0);
+
+		chaos::BitmapAtlas::AtlasInput input;
+		chaos::BitmapAtlas::FolderInfoInput * folder_input = input.AddFolder("folder_input", 0);
+		for (int i = 0; i < bitmap_count; ++i)
+			AddFakeBitmap(folder_input, std::to_string(i).c_str(), random_generator);
+
+		for (auto const & algorithm : algorithms)
+		{
+			if (algorithm.first == chaos::BitmapAtlas::AtlasPackingAlgorithm::CORNERS && bitmap_count > 1000) // far too slow
+				continue;
+
+			chaos::BitmapAtlas::AtlasGeneratorParams params = chaos::BitmapAtlas::AtlasGeneratorParams(1024, 1024, ATLAS_PADDING, chaos::PixelFormatMergeParams());
+			params.packing_algorithm = algorithm.first;
+
+			chaos::BitmapAtlas::Atlas          atlas;
+			chaos::BitmapAtlas::AtlasGenerator generator;
+
+			auto start = std::chrono::steady_clock::now();
+			bool result = generator.ComputeResult(input, atlas, params);
+			double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			if (!result)
+			{
+				std::cout << "bitmaps: " << bitmap_count << " | " << algorithm.second << ": failed" << std::endl;
+				continue;
+			}
+
+			std::cout << "bitmaps: " << bitmap_count
+				<< " | " << algorithm.second << ": " << duration << " ms"
+				<< " | pages: " << atlas.GetBitmapCount()
+				<< " | fill ratio: " << 100.0f * ComputeFillRatio(atlas) << " %" << std::endl;
+		}
+	}
+
+	virtual int Main() override
+	{
+		chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+		BenchmarkPackingAlgorithms(250);
+		BenchmarkPackingAlgorithms(1000);
+		BenchmarkPackingAlgorithms(4000);
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "chaos/Chaos.h"
+
+// an object of a typical size for the pools
+class PooledObject
+{
+public:
+
+	PooledObject(int in_value) : value(in_value) {}
+
+	int value = 0;
+	float data[15];
+};
+
+// each thread keeps some living objects and randomly frees/allocates them
+template<typename ALLOCATE_FUNC, typename FREE_FUNC>
+static void RunThreadChurn(size_t thread_index, size_t live_count, size_t churn_count, ALLOCATE_FUNC const& allocate_func, FREE_FUNC const& free_func)
+{
+	std::mt19937 random_generator((unsigned int)(12345 + thread_index));
+	std::uniform_int_distribution<size_t> index_distribution(0, live_count - 1);
+
+	std::vector<PooledObject*> objects;
+	objects.reserve(live_count);
+	for (size_t i = 0; i < live_count; ++i)
+		objects.push_back(allocate_func(int(i)));
+
+	for (size_t i = 0; i < churn_count; ++i)
+	{
+		size_t index = index_distribution(random_generator);
+		free_func(objects[index]);
+		objects[index] = allocate_func(int(i));
+	}
+
+	for (PooledObject* object : objects)
+		free_func(object);
+}
+
+// start all threads, wait for them and return the average duration of a Free + Allocate
+template<typename THREAD_FUNC>
+static double RunThreads(size_t thread_count, size_t churn_count, THREAD_FUNC const& thread_func)
+{
+	std::vector<std::thread> threads;
+	threads.reserve(thread_count);
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < thread_count; ++i)
+		threads.emplace_back([i, &thread_func]() { thread_func(i); });
+	for (std::thread& thread : threads)
+		thread.join();
+	double duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+	return duration / double(thread_count * churn_count);
+}
+
+static void BenchmarkContention(size_t thread_count, size_t live_count, size_t churn_count)
+{
+	// the lock-free pool
+	double concurrent_pool_duration = 0.0;
+	{
+		chaos::ConcurrentObjectPool<PooledObject> pool;
+		concurrent_pool_duration = RunThreads(thread_count, churn_count, [&](size_t thread_index)
+		{
+			RunThreadChurn(thread_index, live_count, churn_count,
+				[&](int value) { return pool.Allocate(value); },
+				[&](PooledObject* object) { pool.Free(object); });
+		});
+	}
+
+	// the lock-free pool with a magazine per thread
+	double thread_cache_duration = 0.0;
+	{
+		chaos::ConcurrentObjectPool<PooledObject> pool;
+		thread_cache_duration = RunThreads(thread_count, churn_count, [&](size_t thread_index)
+		{
+			chaos::ObjectPoolThreadCache<PooledObject> cache(pool);
+			RunThreadChurn(thread_index, live_count, churn_count,
+				[&](int value) { return cache.Allocate(value); },
+				[&](PooledObject* object) { cache.Free(object); });
+		});
+	}
+
+	// a single threaded pool protected by a mutex (the previous implementation)
+	double mutex_pool_duration = 0.0;
+	{
+		boost::mutex mutex;
+		chaos::ObjectPool<PooledObject> pool;
+		mutex_pool_duration = RunThreads(thread_count, churn_count, [&](size_t thread_index)
+		{
+			RunThreadChurn(thread_index, live_count, churn_count,
+				[&](int value) { boost::lock_guard<boost::mutex> lock(mutex); return pool.Allocate(value); },
+				[&](PooledObject* object) { boost::lock_guard<boost::mutex> lock(mutex); pool.Free(object); });
+		});
+	}
+
+	// new/delete for reference
+	double new_duration = RunThreads(thread_count, churn_count, [&](size_t thread_index)
+	{
+		RunThreadChurn(thread_index, live_count, churn_count,
+			[](int value) { return new PooledObject(value); },
+			[](PooledObject* object) { delete(object); });
+	});
+
+	std::cout << "threads: " << thread_count
+		<< " | ConcurrentObjectPool: " << concurrent_pool_duration << " ns"
+		<< " | ObjectPoolThreadCache: " << thread_cache_duration << " ns"
+		<< " | mutex + ObjectPool: " << mutex_pool_duration << " ns"
+		<< " | delete + new: " << new_duration << " ns" << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	size_t max_thread_count = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+	for (size_t thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+		BenchmarkContention(thread_count, 1000, 1000000);
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
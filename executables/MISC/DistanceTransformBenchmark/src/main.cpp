@@ -0,0 +1,187 @@
+#include "chaos/Chaos.h"
+
+// an image with some random rectangles of various opacity (only the most opaque are kept by the filter of the benchmark)
+static FIBITMAP * GenerateMaskImage(int width, int height, int rectangle_count)
+{
+	FIBITMAP * result = chaos::ImageTools::GenFreeImage(chaos::PixelFormat::BGRA, width, height);
+	if (result == nullptr)
+		return nullptr;
+
+	chaos::ImageDescription description = chaos::ImageTools::GetImageDescription(result);
+	for (int y = 0; y < height; ++y)
+		memset((char *)description.data + y * description.pitch_size, 0, description.line_size);
+
+	std::mt19937 random_generator(12345);
+	for (int i = 0; i < rectangle_count; ++i)
+	{
+		int w = 1 + int(random_generator() % 24);
+		int h = 1 + int(random_generator() % 24);
+		int x0 = int(random_generator() % (width - w));
+		int y0 = int(random_generator() % (height - h));
+
+		chaos::PixelBGRA color;
+		color.B = (unsigned char)(random_generator() % 256);
+		color.G = (unsigned char)(random_generator() % 256);
+		color.R = (unsigned char)(random_generator() % 256);
+		color.A = (unsigned char)(random_generator() % 256);
+
+		for (int y = y0; y < y0 + h; ++y)
+		{
+			chaos::PixelBGRA * line = (chaos::PixelBGRA *)((char *)description.data + y * description.pitch_size);
+			for (int x = x0; x < x0 + w; ++x)
+				line[x] = color;
+		}
+	}
+	return result;
+}
+
+// the previous implementation : search a kept pixel in the disk around each destination pixel
+static FIBITMAP * BruteForceOutline(chaos::ImageProcessorOutline const & processor, chaos::ImageDescription const & src_desc)
+{
+	int distance = processor.distance;
+	int dest_width = src_desc.width + 2 * distance;
+	int dest_height = src_desc.height + 2 * distance;
+
+	FIBITMAP * result = chaos::ImageTools::GenFreeImage(chaos::PixelFormat::BGRA, dest_width, dest_height);
+	if (result == nullptr)
+		return nullptr;
+
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> src_accessor(src_desc);
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> dst_accessor(chaos::ImageTools::GetImageDescription(result));
+
+	chaos::PixelRGBAFloat o = processor.color;
+	chaos::PixelRGBAFloat e = processor.empty_color;
+
+	chaos::PixelBGRA outline, empty;
+	chaos::PixelConverter::Convert(outline, o);
+	chaos::PixelConverter::Convert(empty, e);
+
+	int d2 = distance * distance;
+
+	for (int y = 0; y < dest_height; ++y)
+	{
+		for (int x = 0; x < dest_width; ++x)
+		{
+			int src_x = x - distance;
+			int src_y = y - distance;
+
+			int min_src_x = std::max(0, src_x - distance);
+			int max_src_x = std::min(src_x + distance, src_desc.width - 1);
+
+			int min_src_y = std::max(0, src_y - distance);
+			int max_src_y = std::min(src_y + distance, src_desc.height - 1);
+
+			bool all_neighboor_empty = true;
+			for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
+			{
+				for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
+				{
+					int dx = src_x - sx;
+					int dy = src_y - sy;
+					if (dx * dx + dy * dy <= d2)
+						all_neighboor_empty = !processor.color_filter.Filter(src_accessor(sx, sy));
+				}
+			}
+
+			if (all_neighboor_empty)
+				dst_accessor(x, y) = empty;
+			else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && processor.color_filter.Filter(src_accessor(src_x, src_y)))
+				dst_accessor(x, y) = src_accessor(src_x, src_y);
+			else
+				dst_accessor(x, y) = outline;
+		}
+	}
+	return result;
+}
+
+// count the pixels that differ between 2 images of the same format
+static size_t CountDifferentPixels(FIBITMAP * image1, FIBITMAP * image2)
+{
+	chaos::ImageDescription desc1 = chaos::ImageTools::GetImageDescription(image1);
+	chaos::ImageDescription desc2 = chaos::ImageTools::GetImageDescription(image2);
+	if (desc1.width != desc2.width || desc1.height != desc2.height || desc1.pixel_format != desc2.pixel_format)
+		return size_t(desc1.width) * size_t(desc1.height);
+
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor1(desc1);
+	chaos::ImagePixelAccessor<chaos::PixelBGRA> accessor2(desc2);
+
+	size_t result = 0;
+	for (int y = 0; y < desc1.height; ++y)
+	{
+		for (int x = 0; x < desc1.width; ++x)
+		{
+			chaos::PixelBGRA const & p1 = accessor1(x, y);
+			chaos::PixelBGRA const & p2 = accessor2(x, y);
+			if (p1.B != p2.B || p1.G != p2.G || p1.R != p2.R || p1.A != p2.A)
+				++result;
+		}
+	}
+	return result;
+}
+
+static void BenchmarkDistanceTransform(FIBITMAP * image, int distance, int iteration_count, bool brute_force)
+{
+	chaos::ImageDescription description = chaos::ImageTools::GetImageDescription(image);
+
+	chaos::ImageProcessorOutline processor;
+	processor.distance = distance;
+	processor.color_filter.distance = 0.5f; // only keep the most opaque pixels
+	processor.color = { 1.0f, 0.0f, 0.0f, 1.0f };
+
+	// the distance transform
+	FIBITMAP * transform_result = nullptr;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iteration_count; ++i)
+	{
+		if (transform_result != nullptr)
+			FreeImage_Unload(transform_result);
+		transform_result = processor.ProcessImage(description);
+	}
+	double transform_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+
+	std::cout << "distance: " << distance << " | distance transform: " << transform_duration << " ms";
+
+	// the disk search
+	if (brute_force)
+	{
+		start = std::chrono::steady_clock::now();
+		FIBITMAP * brute_force_result = BruteForceOutline(processor, description);
+		double brute_force_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << " | disk search: " << brute_force_duration << " ms";
+
+		if (transform_result == nullptr || brute_force_result == nullptr)
+			std::cout << " | failed to generate the images";
+		else
+			std::cout << " | different pixels: " << CountDifferentPixels(transform_result, brute_force_result);
+
+		if (brute_force_result != nullptr)
+			FreeImage_Unload(brute_force_result);
+	}
+	std::cout << std::endl;
+
+	if (transform_result != nullptr)
+		FreeImage_Unload(transform_result);
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	chaos::JobManager::GetInstance()->StartWorkers(); // the distance transform runs row by row on the workers
+
+	FIBITMAP * image = GenerateMaskImage(512, 512, 200);
+	if (image != nullptr)
+	{
+		for (int distance = 1; distance <= 64; distance *= 2)
+			BenchmarkDistanceTransform(image, distance, 10, distance <= 16);
+		FreeImage_Unload(image);
+	}
+
+	chaos::JobManager::GetInstance()->StopWorkers();
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
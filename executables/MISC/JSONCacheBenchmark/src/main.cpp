@@ -0,0 +1,122 @@
+#include "chaos/Chaos.h"
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	/** search the LUDUMDARE games from the executable directory up to the root of the repository */
+	boost::filesystem::path FindLudumDarePath() const
+	{
+		for (boost::filesystem::path p = GetApplicationPath(); !p.empty(); p = p.parent_path())
+		{
+			boost::filesystem::path result = p / "executables" / "LUDUMDARE";
+			if (boost::filesystem::is_directory(result))
+				return result;
+			if (p == p.root_path())
+				break;
+		}
+		return {};
+	}
+
+	/** get the configurations of a game (the JSON files at the root of its resources) */
+	std::vector<boost::filesystem::path> GetGameConfigurations(boost::filesystem::path const & resources_path) const
+	{
+		std::vector<boost::filesystem::path> result;
+
+		boost::system::error_code error_code;
+		for (boost::filesystem::directory_iterator it(resources_path, error_code); !error_code && it != boost::filesystem::directory_iterator(); it.increment(error_code))
+			if (boost::filesystem::is_regular_file(it->path()) && chaos::FileTools::IsTypedFile(it->path(), "json"))
+				result.push_back(it->path());
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	/** enable or disable the JSON cache (see JSONRecursiveLoader) */
+	void SetJSONCacheEnabled(bool enabled)
+	{
+		auto it = std::find(arguments.begin(), arguments.end(), "-NoJSONCache");
+		if (enabled && it != arguments.end())
+			arguments.erase(it);
+		else if (!enabled && it == arguments.end())
+			arguments.push_back("-NoJSONCache");
+	}
+
+	/** load all configurations several times and returns the average duration (milliseconds) */
+	double MeasureLoads(std::vector<boost::filesystem::path> const & paths, int iteration_count)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iteration_count; ++i)
+		{
+			for (boost::filesystem::path const & path : paths)
+			{
+				nlohmann::json json;
+				if (!chaos::JSONTools::LoadJSONFile(path, json, chaos::LoadFileFlag::RECURSIVE))
+					std::cout << "failed to load " << path.string() << std::endl;
+			}
+		}
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+	}
+
+	void BenchmarkGame(boost::filesystem::path const & game_path, int iteration_count)
+	{
+		std::vector<boost::filesystem::path> paths = GetGameConfigurations(game_path / "resources");
+		if (paths.size() == 0)
+			return;
+
+		// without the cache : every file is parsed and the includes are resolved
+		SetJSONCacheEnabled(false);
+		double uncached_duration = MeasureLoads(paths, iteration_count);
+
+		// the first load with the cache parses the files and writes the cache
+		SetJSONCacheEnabled(true);
+		boost::system::error_code error_code;
+		boost::filesystem::remove_all(GetUserLocalTempPath() / "json_cache", error_code);
+		double cold_duration = MeasureLoads(paths, 1);
+
+		// the next ones only check the dependencies and read the cache
+		double cached_duration = MeasureLoads(paths, iteration_count);
+
+		std::cout << game_path.filename().string() << " | files: " << paths.size()
+			<< " | no cache: " << uncached_duration << " ms"
+			<< " | cache (first load): " << cold_duration << " ms"
+			<< " | cache: " << cached_duration << " ms" << std::endl;
+	}
+
+	virtual int Main() override
+	{
+		chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+		boost::filesystem::path ludum_dare_path = FindLudumDarePath();
+		if (GetUserLocalTempPath().empty())
+		{
+			std::cout << "no user local temp path : the cache cannot be used" << std::endl;
+		}
+		else if (ludum_dare_path.empty())
+		{
+			std::cout << "executables/LUDUMDARE not found from " << GetApplicationPath().string() << std::endl;
+		}
+		else
+		{
+			CreateUserLocalTempDirectory();
+
+			std::vector<boost::filesystem::path> game_paths;
+			boost::system::error_code error_code;
+			for (boost::filesystem::directory_iterator it(ludum_dare_path, error_code); !error_code && it != boost::filesystem::directory_iterator(); it.increment(error_code))
+				if (boost::filesystem::is_directory(it->path() / "resources"))
+					game_paths.push_back(it->path());
+			std::sort(game_paths.begin(), game_paths.end());
+
+			for (boost::filesystem::path const & game_path : game_paths)
+				BenchmarkGame(game_path, 20);
+		}
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
@@ -0,0 +1,71 @@
+#include "chaos/Chaos.h"
+
+// several threads log at the same time : returns the number of lines per second (until all lines are dispatched)
+static double BenchmarkOutput(size_t thread_count, size_t line_count)
+{
+	chaos::shared_ptr<chaos::Logger> logger = new chaos::Logger;
+
+	std::vector<std::thread> threads;
+	threads.reserve(thread_count);
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < thread_count; ++i)
+	{
+		threads.emplace_back([logger = logger.get(), i, line_count]()
+		{
+			for (size_t j = 0; j < line_count; ++j)
+				logger->Message("benchmark", "thread %d : line %d", int(i), int(j));
+		});
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+	logger->Flush();
+	double duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	return double(thread_count * line_count) / duration;
+}
+
+// read all lines kept in memory (i.e what the ImGui log window does each frame)
+static void BenchmarkRead(size_t iteration_count)
+{
+	chaos::shared_ptr<chaos::Logger> logger = new chaos::Logger;
+	for (size_t i = 0; i < chaos::Logger::default_max_line_count; ++i)
+		logger->Message("benchmark", "line %d", int(i));
+	logger->Flush();
+
+	size_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iteration_count; ++i)
+		for (chaos::LogLine const& line : logger->GetLines())
+			checksum += line.content.size();
+	double copy_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iteration_count; ++i)
+		logger->ForEachLine([&checksum](chaos::LogLine const& line)
+		{
+			checksum += line.content.size();
+		});
+	double visit_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+
+	std::cout << "read " << chaos::Logger::default_max_line_count << " lines"
+		<< " | GetLines: " << copy_duration << " ms"
+		<< " | ForEachLine: " << visit_duration << " ms"
+		<< " | checksum: " << checksum << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	size_t max_thread_count = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+	for (size_t thread_count = 1; thread_count <= max_thread_count; thread_count *= 2)
+		std::cout << "threads: " << thread_count << " | " << BenchmarkOutput(thread_count, 100000) << " lines/s" << std::endl;
+
+	BenchmarkRead(100);
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
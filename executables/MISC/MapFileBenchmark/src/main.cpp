@@ -0,0 +1,101 @@
+#include "chaos/Chaos.h"
+
+// create a file with some random content
+static bool GenerateFile(boost::filesystem::path const & path, size_t size)
+{
+	std::ofstream stream(path.string().c_str(), std::ios::binary);
+	if (!stream)
+		return false;
+
+	std::mt19937 random_generator(12345);
+	std::vector<char> block(1024 * 1024);
+	for (size_t written = 0; written < size; written += block.size())
+	{
+		for (char & c : block)
+			c = char(random_generator());
+		stream.write(block.data(), std::streamsize(std::min(block.size(), size - written)));
+	}
+	return bool(stream);
+}
+
+// read every byte of the buffer
+template<typename T>
+static size_t ReadAll(chaos::Buffer<T> const & buffer)
+{
+	size_t result = 0;
+	for (size_t i = 0; i < buffer.bufsize; ++i)
+		result += (unsigned char)buffer.data[i];
+	return result;
+}
+
+// read one byte per page (i.e a parser that only looks at some parts of the file)
+template<typename T>
+static size_t ReadPages(chaos::Buffer<T> const & buffer)
+{
+	size_t result = 0;
+	for (size_t i = 0; i < buffer.bufsize; i += 4096)
+		result += (unsigned char)buffer.data[i];
+	return result;
+}
+
+// open the file, read it with a given access function and returns the average duration (milliseconds)
+template<typename LOAD_FUNC, typename READ_FUNC>
+static double MeasureLoad(boost::filesystem::path const & path, int iteration_count, size_t & checksum, LOAD_FUNC const & load_func, READ_FUNC const & read_func)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iteration_count; ++i)
+	{
+		auto buffer = load_func(path);
+		if (buffer)
+			checksum += read_func(buffer);
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+}
+
+static void BenchmarkFile(boost::filesystem::path const & path, size_t size, int iteration_count)
+{
+	auto load_file = [](boost::filesystem::path const & p) { return chaos::FileTools::LoadFile(p); };
+	auto map_file = [](boost::filesystem::path const & p) { return chaos::FileTools::MapFile(p); };
+
+	size_t checksum = 0;
+	double load_all = MeasureLoad(path, iteration_count, checksum, load_file, ReadAll<char>);
+	double map_all = MeasureLoad(path, iteration_count, checksum, map_file, ReadAll<char const>);
+	double load_pages = MeasureLoad(path, iteration_count, checksum, load_file, ReadPages<char>);
+	double map_pages = MeasureLoad(path, iteration_count, checksum, map_file, ReadPages<char const>);
+
+	std::cout << "size: " << (size / (1024 * 1024)) << " MB"
+		<< " | whole file : LoadFile " << load_all << " ms, MapFile " << map_all << " ms"
+		<< " | one byte per page : LoadFile " << load_pages << " ms, MapFile " << map_pages << " ms"
+		<< " | checksum: " << checksum << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	boost::filesystem::path directory;
+	if (chaos::FileTools::CreateTemporaryDirectory("MapFileBenchmark", directory))
+	{
+		// the files are read once before the measures, so that both methods work on files in the system cache
+		for (size_t size_mb : { 1, 16, 64, 256 })
+		{
+			size_t size = size_mb * 1024 * 1024;
+
+			boost::filesystem::path path = directory / chaos::StringTools::Printf("file_%dMB.bin", int(size_mb));
+			if (!GenerateFile(path, size))
+			{
+				std::cout << "failed to generate " << path.string() << std::endl;
+				continue;
+			}
+			chaos::FileTools::LoadFile(path);
+			BenchmarkFile(path, size, (size_mb < 64) ? 20 : 5);
+
+			boost::system::error_code error_code;
+			boost::filesystem::remove(path, error_code);
+		}
+	}
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
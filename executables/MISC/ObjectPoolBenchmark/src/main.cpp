@@ -0,0 +1,80 @@
+#include "chaos/Chaos.h"
+
+// an object of a typical size for the pools
+class PooledObject
+{
+public:
+
+	PooledObject(int in_value) : value(in_value) {}
+
+	int value = 0;
+	float data[15];
+};
+
+static double GetElapsedNanoseconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Free(...) searches the node owning the object. With the lookup table, its cost must not depend on the number of living objects
+static void BenchmarkFree(size_t live_count, size_t churn_count)
+{
+	std::mt19937 random_generator(12345);
+
+	chaos::ObjectPool<PooledObject> pool;
+
+	std::vector<PooledObject*> objects;
+	objects.reserve(live_count);
+	for (size_t i = 0; i < live_count; ++i)
+		objects.push_back(pool.Allocate(int(i)));
+
+	// free a random object and allocate a new one (the pool keeps the same number of living objects)
+	std::uniform_int_distribution<size_t> index_distribution(0, live_count - 1);
+
+	std::vector<size_t> indices;
+	indices.reserve(churn_count);
+	for (size_t i = 0; i < churn_count; ++i)
+		indices.push_back(index_distribution(random_generator));
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t index : indices)
+	{
+		pool.Free(objects[index]);
+		objects[index] = pool.Allocate(int(index));
+	}
+	double pool_duration = GetElapsedNanoseconds(start);
+
+	for (PooledObject* object : objects)
+		pool.Free(object);
+
+	// the same with new/delete for reference
+	for (size_t i = 0; i < live_count; ++i)
+		objects[i] = new PooledObject(int(i));
+
+	start = std::chrono::steady_clock::now();
+	for (size_t index : indices)
+	{
+		delete(objects[index]);
+		objects[index] = new PooledObject(int(index));
+	}
+	double new_duration = GetElapsedNanoseconds(start);
+
+	for (PooledObject* object : objects)
+		delete(object);
+
+	std::cout << "living objects: " << live_count
+		<< " | ObjectPool Free + Allocate: " << (pool_duration / double(churn_count)) << " ns"
+		<< " | delete + new: " << (new_duration / double(churn_count)) << " ns" << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	for (size_t live_count : { 100, 1000, 10000, 100000, 1000000 })
+		BenchmarkFree(live_count, 1000000);
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
@@ -0,0 +1,176 @@
+#include "chaos/Chaos.h"
+
+// search all requests and return the average duration of a lookup
+template<typename FUNC>
+static double MeasureLookups(std::vector<chaos::ObjectRequest> const & requests, size_t & found_count, FUNC const & func)
+{
+	found_count = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (chaos::ObjectRequest const & request : requests)
+		if (func(request) != nullptr)
+			++found_count;
+	double duration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+	return duration / double(requests.size());
+}
+
+static void BenchmarkFontLookup(size_t character_count, size_t lookup_count)
+{
+	// a font with many glyphs (i.e a CJK font)
+	chaos::BitmapAtlas::FontInfo font_info;
+	for (size_t i = 0; i < character_count; ++i)
+	{
+		chaos::BitmapAtlas::CharacterInfo character_info;
+		character_info.SetTag(chaos::TagType(32 + i));
+		character_info.SetName(chaos::StringTools::Printf("glyph_%d", int(i)).c_str());
+		font_info.elements.push_back(std::move(character_info));
+	}
+
+	// the requests (some of them do not match any glyph)
+	std::mt19937 random_generator(12345);
+	std::uniform_int_distribution<size_t> index_distribution(0, character_count + character_count / 10);
+
+	std::vector<std::string> names;
+	std::vector<chaos::ObjectRequest> tag_requests;
+	std::vector<chaos::ObjectRequest> name_requests;
+	names.reserve(lookup_count);
+	for (size_t i = 0; i < lookup_count; ++i)
+	{
+		size_t index = index_distribution(random_generator);
+		tag_requests.push_back(chaos::ObjectRequest(chaos::TagType(32 + index)));
+		names.push_back(chaos::StringTools::Printf("GLYPH_%d", int(index))); // the names are case insensitive
+	}
+	for (std::string const & name : names)
+		name_requests.push_back(chaos::ObjectRequest(name));
+
+	size_t linear_tag_found = 0;
+	size_t linear_name_found = 0;
+	size_t index_tag_found = 0;
+	size_t index_name_found = 0;
+
+	// linear scan (the index has not been built yet)
+	double linear_tag_duration = MeasureLookups(tag_requests, linear_tag_found, [&font_info](chaos::ObjectRequest const & request) { return font_info.GetCharacterInfo(request); });
+	double linear_name_duration = MeasureLookups(name_requests, linear_name_found, [&font_info](chaos::ObjectRequest const & request) { return font_info.GetCharacterInfo(request); });
+
+	// with the index
+	auto start = std::chrono::steady_clock::now();
+	font_info.BuildIndices();
+	double build_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	double index_tag_duration = MeasureLookups(tag_requests, index_tag_found, [&font_info](chaos::ObjectRequest const & request) { return font_info.GetCharacterInfo(request); });
+	double index_name_duration = MeasureLookups(name_requests, index_name_found, [&font_info](chaos::ObjectRequest const & request) { return font_info.GetCharacterInfo(request); });
+
+	std::cout << "characters: " << character_count << " | index build: " << build_duration << " ms" << std::endl;
+	std::cout << "  by tag  | linear: " << linear_tag_duration << " ns | index: " << index_tag_duration << " ns | found: " << linear_tag_found << "/" << index_tag_found << std::endl;
+	std::cout << "  by name | linear: " << linear_name_duration << " ns | index: " << index_name_duration << " ns | found: " << linear_name_found << "/" << index_name_found << std::endl;
+}
+
+// an atlas with a font whose glyphs are the printable ASCII characters (the glyphs have no bitmap)
+static void InitializeTextAtlas(chaos::BitmapAtlas::Atlas & atlas)
+{
+	chaos::BitmapAtlas::FontInfo font_info;
+	font_info.SetName("font");
+	font_info.glyph_width = 16;
+	font_info.glyph_height = 24;
+	font_info.ascender = 24;
+	font_info.descender = -8;
+	font_info.face_height = 32;
+
+	for (int c = 32; c < 127; ++c)
+	{
+		chaos::BitmapAtlas::CharacterInfo character_info;
+		character_info.SetTag(chaos::TagType(c));
+		character_info.SetName(chaos::StringTools::Printf("glyph_%d", c).c_str());
+		character_info.width = 16;
+		character_info.height = 24;
+		character_info.advance.x = 16 * 64;
+		character_info.bitmap_top = 24;
+		font_info.elements.push_back(std::move(character_info));
+	}
+	atlas.GetRootFolder()->fonts.push_back(std::move(font_info));
+}
+
+// a text of random words on lines of about 80 characters (no markup)
+static std::string GenerateText(size_t character_count, std::mt19937 & random_generator)
+{
+	std::string result;
+	result.reserve(character_count);
+
+	size_t line_length = 0;
+	while (result.size() < character_count)
+	{
+		size_t word_length = 1 + random_generator() % 10;
+		for (size_t i = 0; i < word_length; ++i)
+			result.push_back(char('a' + random_generator() % 26));
+		line_length += word_length + 1;
+		if (line_length > 80)
+		{
+			result.push_back('\n');
+			line_length = 0;
+		}
+		else
+			result.push_back(' ');
+	}
+	result.resize(character_count);
+	return result;
+}
+
+// lay out texts with the ParticleTextGenerator and return the average duration for a text
+static double MeasureTextGeneration(chaos::ParticleTextGenerator::Generator const & generator, std::vector<std::string> const & texts, size_t & token_count)
+{
+	chaos::ParticleTextGenerator::GeneratorParams params;
+	params.font_info_name = "font";
+
+	token_count = 0;
+
+	chaos::ParticleTextGenerator::GeneratorResult result;
+
+	auto start = std::chrono::steady_clock::now();
+	for (std::string const & text : texts)
+	{
+		generator.Generate(text.c_str(), result, params);
+		token_count += result.GetTokenCount();
+	}
+	double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	return duration / double(texts.size());
+}
+
+static void BenchmarkTextGeneration(size_t character_count, size_t text_count)
+{
+	chaos::BitmapAtlas::Atlas atlas;
+	InitializeTextAtlas(atlas);
+
+	chaos::ParticleTextGenerator::Generator generator(atlas);
+
+	std::mt19937 random_generator(12345);
+	std::vector<std::string> texts;
+	for (size_t i = 0; i < text_count; ++i)
+		texts.push_back(GenerateText(character_count, random_generator));
+
+	size_t linear_token_count = 0;
+	size_t index_token_count = 0;
+
+	// linear scan (the indices have not been built yet)
+	double linear_duration = MeasureTextGeneration(generator, texts, linear_token_count);
+	// with the indices
+	atlas.GetRootFolder()->BuildIndices();
+	double index_duration = MeasureTextGeneration(generator, texts, index_token_count);
+
+	std::cout << "text generation (" << character_count << " characters) | linear: " << linear_duration << " ms | index: " << index_duration << " ms | tokens: " << linear_token_count << "/" << index_token_count << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	for (size_t character_count : { 100, 1000, 10000 })
+		BenchmarkFontLookup(character_count, 20000);
+
+	BenchmarkTextGeneration(10000, 20);
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
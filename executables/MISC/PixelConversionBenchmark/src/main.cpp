@@ -0,0 +1,136 @@
+#include "chaos/Chaos.h"
+
+// fill an image with random bytes (float components are kept in [0..1])
+template<typename PIXEL_TYPE>
+static void FillImage(chaos::ImageDescription & description, std::mt19937 & random_generator)
+{
+	chaos::ImagePixelAccessor<PIXEL_TYPE> accessor(description);
+	for (int y = 0; y < description.height; ++y)
+	{
+		for (int x = 0; x < description.width; ++x)
+		{
+			chaos::PixelRGBAFloat color;
+			color.R = float(random_generator() % 256) / 255.0f;
+			color.G = float(random_generator() % 256) / 255.0f;
+			color.B = float(random_generator() % 256) / 255.0f;
+			color.A = float(random_generator() % 256) / 255.0f;
+			chaos::PixelConverter::Convert(accessor(x, y), color);
+		}
+	}
+}
+
+// the name of a pixel type
+template<typename PIXEL_TYPE>
+static char const * GetPixelTypeName()
+{
+	if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelGray>)
+		return "Gray";
+	else if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelBGR>)
+		return "BGR";
+	else if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelBGRA>)
+		return "BGRA";
+	else if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelGrayFloat>)
+		return "GrayFloat";
+	else if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelRGBFloat>)
+		return "RGBFloat";
+	else if constexpr (std::is_same_v<PIXEL_TYPE, chaos::PixelRGBAFloat>)
+		return "RGBAFloat";
+	else
+		return "DepthStencil";
+}
+
+// check whether 2 images have the same pixels (padding at the end of the lines is ignored)
+static bool HaveSamePixels(chaos::ImageDescription const & desc1, chaos::ImageDescription const & desc2)
+{
+	if (desc1.width != desc2.width || desc1.height != desc2.height || desc1.line_size != desc2.line_size)
+		return false;
+	for (int y = 0; y < desc1.height; ++y)
+		if (memcmp((char const *)desc1.data + y * desc1.pitch_size, (char const *)desc2.data + y * desc2.pitch_size, desc1.line_size) != 0)
+			return false;
+	return true;
+}
+
+template<typename SRC_PIXEL_TYPE, typename DST_PIXEL_TYPE>
+static void BenchmarkConversion(int size, int iteration_count)
+{
+	std::string name = chaos::StringTools::Printf("%s -> %s", GetPixelTypeName<SRC_PIXEL_TYPE>(), GetPixelTypeName<DST_PIXEL_TYPE>());
+
+	FIBITMAP * src_image = chaos::ImageTools::GenFreeImage(chaos::PixelFormat::GetPixelFormat<SRC_PIXEL_TYPE>(), size, size);
+	FIBITMAP * dst_image = chaos::ImageTools::GenFreeImage(chaos::PixelFormat::GetPixelFormat<DST_PIXEL_TYPE>(), size, size);
+	FIBITMAP * reference_image = chaos::ImageTools::GenFreeImage(chaos::PixelFormat::GetPixelFormat<DST_PIXEL_TYPE>(), size, size);
+
+	if (src_image != nullptr && dst_image != nullptr && reference_image != nullptr)
+	{
+		chaos::ImageDescription src_desc = chaos::ImageTools::GetImageDescription(src_image);
+		chaos::ImageDescription dst_desc = chaos::ImageTools::GetImageDescription(dst_image);
+		chaos::ImageDescription reference_desc = chaos::ImageTools::GetImageDescription(reference_image);
+
+		std::mt19937 random_generator(12345);
+		FillImage<SRC_PIXEL_TYPE>(src_desc, random_generator);
+
+		chaos::ImagePixelAccessor<SRC_PIXEL_TYPE> src_accessor(src_desc);
+		chaos::ImagePixelAccessor<DST_PIXEL_TYPE> reference_accessor(reference_desc);
+
+		double megapixels = double(size) * double(size) / 1000000.0;
+
+		for (chaos::ImageTransform image_transform : { chaos::ImageTransform::NO_TRANSFORM, chaos::ImageTransform::CENTRAL_SYMETRY })
+		{
+			bool symetry = (image_transform == chaos::ImageTransform::CENTRAL_SYMETRY);
+
+			// the line kernels (ConvertPixelLine)
+			auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iteration_count; ++i)
+				chaos::ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, 0, 0, size, size, image_transform);
+			double line_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+
+			// the previous implementation : a conversion per pixel through the accessors
+			start = std::chrono::steady_clock::now();
+			for (int i = 0; i < iteration_count; ++i)
+				for (int y = 0; y < size; ++y)
+					for (int x = 0; x < size; ++x)
+						chaos::PixelConverter::Convert(symetry ? reference_accessor(size - 1 - x, size - 1 - y) : reference_accessor(x, y), src_accessor(x, y));
+			double pixel_duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+
+			std::cout << name << (symetry ? " (central symetry)" : "")
+				<< " | ConvertPixelLine: " << line_duration << " ms (" << (megapixels * 1000.0 / line_duration) << " Mpixels/s)"
+				<< " | per pixel: " << pixel_duration << " ms (" << (megapixels * 1000.0 / pixel_duration) << " Mpixels/s)"
+				<< " | " << (HaveSamePixels(dst_desc, reference_desc) ? "same pixels" : "DIFFERENT PIXELS") << std::endl;
+		}
+	}
+	else
+	{
+		std::cout << name << " | unsupported" << std::endl;
+	}
+
+	if (src_image != nullptr)
+		FreeImage_Unload(src_image);
+	if (dst_image != nullptr)
+		FreeImage_Unload(dst_image);
+	if (reference_image != nullptr)
+		FreeImage_Unload(reference_image);
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	int size = 2048;
+	int iteration_count = 10;
+
+	// all pairs of pixel types
+	chaos::meta::for_each<chaos::PixelTypes>([size, iteration_count](auto src_value)
+	{
+		using src_pixel_type = typename decltype(src_value)::type;
+
+		chaos::meta::for_each<chaos::PixelTypes>([size, iteration_count](auto dst_value)
+		{
+			using dst_pixel_type = typename decltype(dst_value)::type;
+
+			BenchmarkConversion<src_pixel_type, dst_pixel_type>(size, iteration_count);
+		});
+	});
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
\ No newline at end of file
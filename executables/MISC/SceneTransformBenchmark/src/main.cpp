@@ -0,0 +1,186 @@
+#include "chaos/Chaos.h"
+
+// a scene tree with the parent of each node (the nodes are sorted so that parents come first)
+class SceneTree
+{
+public:
+
+	/** destructor */
+	~SceneTree()
+	{
+		// detach the nodes from the leaves to the root (each node is destroyed when its parent releases it)
+		for (size_t i = nodes.size(); i-- > 1;)
+			nodes[parents[i]]->RemoveChildNode(nodes[i]);
+	}
+
+	/** create a node and insert it in the tree */
+	chaos::SceneNode * AddNode(int parent_index, std::mt19937 & random_generator)
+	{
+		chaos::SceneNode * result = new chaos::SceneNode;
+		result->SetPosition({ float(random_generator() % 100), float(random_generator() % 100) });
+		result->SetRotator(float(random_generator() % 360) * 0.01f);
+		result->SetScale({ 1.0f, 1.0f });
+
+		if (parent_index < 0)
+			root = result;
+		else
+			nodes[parent_index]->AddChildNode(result);
+
+		nodes.push_back(result);
+		parents.push_back(parent_index);
+		return result;
+	}
+
+	/** the root (owns the whole tree) */
+	chaos::shared_ptr<chaos::SceneNode> root;
+	/** all nodes */
+	std::vector<chaos::SceneNode *> nodes;
+	/** the index of the parent of each node (-1 for the root) */
+	std::vector<int> parents;
+};
+
+// a root with 'chain_count' chains of 'depth' nodes
+static void GenerateDeepTree(SceneTree & tree, int chain_count, int depth)
+{
+	std::mt19937 random_generator(12345);
+
+	tree.AddNode(-1, random_generator);
+	for (int i = 0; i < chain_count; ++i)
+	{
+		int parent_index = 0;
+		for (int j = 0; j < depth; ++j)
+		{
+			tree.AddNode(parent_index, random_generator);
+			parent_index = int(tree.nodes.size()) - 1;
+		}
+	}
+}
+
+// a root with 'width' children, each of them having 'width' children
+static void GenerateWideTree(SceneTree & tree, int width)
+{
+	std::mt19937 random_generator(12345);
+
+	tree.AddNode(-1, random_generator);
+	for (int i = 0; i < width; ++i)
+	{
+		tree.AddNode(0, random_generator);
+		int parent_index = int(tree.nodes.size()) - 1;
+		for (int j = 0; j < width; ++j)
+			tree.AddNode(parent_index, random_generator);
+	}
+}
+
+// the previous implementation : walk the parent chain and combine all matrices
+static glm::mat4 ComputeLocalToWorldFromParents(SceneTree const & tree, int index)
+{
+	glm::mat4 result = tree.nodes[index]->GetLocalToParent();
+	for (int parent_index = tree.parents[index]; parent_index >= 0; parent_index = tree.parents[parent_index])
+		result = tree.nodes[parent_index]->GetLocalToParent() * result;
+	return result;
+}
+
+template<typename FUNC>
+static double MeasureDuration(int iteration_count, FUNC const & func)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iteration_count; ++i)
+		func();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(iteration_count);
+}
+
+static void BenchmarkSceneTree(char const * name, SceneTree & tree, int iteration_count)
+{
+	int node_count = int(tree.nodes.size());
+
+	float checksum = 0.0f;
+
+	// every world matrix through the parent chain
+	double parent_walk_duration = MeasureDuration(iteration_count, [&tree, &checksum, node_count]()
+	{
+		for (int i = 0; i < node_count; ++i)
+			checksum += ComputeLocalToWorldFromParents(tree, i)[3][0];
+	});
+
+	// the whole tree is invalid : update everything and read the cached matrices
+	double full_update_duration = MeasureDuration(iteration_count, [&tree, &checksum, node_count]()
+	{
+		tree.root->SetPosition(tree.root->GetPosition());
+		tree.root->UpdateWorldTransforms();
+		for (int i = 0; i < node_count; ++i)
+			checksum += tree.nodes[i]->GetLocalToWorld()[3][0];
+	});
+
+	// a single leaf moved
+	double leaf_update_duration = MeasureDuration(iteration_count, [&tree, node_count]()
+	{
+		chaos::SceneNode * leaf = tree.nodes[node_count - 1];
+		leaf->SetPosition(leaf->GetPosition());
+		tree.root->UpdateWorldTransforms();
+	});
+
+	// nothing moved
+	double clean_update_duration = MeasureDuration(iteration_count, [&tree]()
+	{
+		tree.root->UpdateWorldTransforms();
+	});
+
+	// compare the cached matrices with the parent walk
+	float max_difference = 0.0f;
+	for (int i = 0; i < node_count; ++i)
+	{
+		glm::mat4 const & cached = tree.nodes[i]->GetLocalToWorld();
+		glm::mat4 reference = ComputeLocalToWorldFromParents(tree, i);
+		for (int c = 0; c < 4; ++c)
+			for (int r = 0; r < 4; ++r)
+				max_difference = std::max(max_difference, std::abs(cached[c][r] - reference[c][r]));
+	}
+
+	std::cout << name << " (" << node_count << " nodes)"
+		<< " | parent walk: " << parent_walk_duration << " ms"
+		<< " | full update: " << full_update_duration << " ms"
+		<< " | leaf moved: " << leaf_update_duration << " ms"
+		<< " | nothing moved: " << clean_update_duration << " ms"
+		<< " | max difference: " << max_difference
+		<< " (" << checksum << ")" << std::endl;
+}
+
+class MyApplication : public chaos::Application
+{
+protected:
+
+	virtual int Main() override
+	{
+		chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+		{
+			SceneTree tree;
+			GenerateDeepTree(tree, 10, 100);
+			BenchmarkSceneTree("deep tree (10 x 100)", tree, 10);
+		}
+		{
+			SceneTree tree;
+			GenerateDeepTree(tree, 10, 1000);
+			BenchmarkSceneTree("deep tree (10 x 1000)", tree, 2);
+		}
+		{
+			SceneTree tree;
+			GenerateWideTree(tree, 100);
+			BenchmarkSceneTree("wide tree (100 x 100)", tree, 10);
+		}
+		{
+			SceneTree tree;
+			GenerateWideTree(tree, 300);
+			BenchmarkSceneTree("wide tree (300 x 300)", tree, 10);
+		}
+
+		chaos::WinTools::PressToContinue();
+
+		return 0;
+	}
+};
+
+int main(int argc, char ** argv, char ** env)
+{
+	return chaos::RunApplication<MyApplication>(argc, argv, env);
+}
\ No newline at end of file
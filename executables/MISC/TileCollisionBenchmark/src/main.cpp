@@ -0,0 +1,269 @@
+#include "chaos/Chaos.h"
+
+// XXX : this benchmark measures
+//         - the broad phase of TileCollisionComputer::Run(...) (the search of the candidate tiles in the TMParticleGrid), comparing
+//           the swept cells with the cells of the box enclosing the whole move (the previous method)
+//         - the whole TileCollisionComputer::Run(...) (broad phase, sort by time of impact and reaction) on a minimal level instance
+//           with a single tile layer
+
+// a map without any tileset (the tiles have no tile information)
+class BenchmarkMap : public chaos::TiledMap::Map
+{
+public:
+
+	BenchmarkMap() : chaos::TiledMap::Map(nullptr, "benchmark") {}
+};
+
+// a tile layer whose particles are given directly
+class BenchmarkLayerInstance : public chaos::TMLayerInstance
+{
+public:
+
+	BenchmarkLayerInstance(chaos::TMLevelInstance * in_level_instance, chaos::ParticleLayerBase * in_particle_layer, glm::vec2 const & tile_size, uint64_t in_collision_mask)
+	{
+		level_instance = in_level_instance;
+		particle_layer = in_particle_layer;
+		collision_mask = in_collision_mask;
+		particle_grid.SetCellSize(tile_size);
+	}
+};
+
+// a level instance with the given layers
+class BenchmarkLevelInstance : public chaos::TMLevelInstance
+{
+public:
+
+	BenchmarkLevelInstance(chaos::TMLevel * in_level)
+	{
+		level = in_level;
+	}
+
+	void AddLayerInstance(chaos::TMLayerInstance * layer_instance)
+	{
+		layer_instances.push_back(layer_instance);
+	}
+};
+
+class MovingBody
+{
+public:
+
+	chaos::box2 box;
+	glm::vec2 velocity = { 0.0f, 0.0f };
+};
+
+static float RandomFloat(std::mt19937& random_generator, float min_value, float max_value)
+{
+	return std::uniform_real_distribution<float>(min_value, max_value)(random_generator);
+}
+
+// add the entries of a list of cells to the candidates (each entry is only counted once)
+static void CollectEntries(chaos::TMParticleGrid const& grid, std::vector<glm::ivec2> const& cells, std::vector<uint32_t>& entries)
+{
+	entries = grid.GetLargeEntries();
+	for (glm::ivec2 const& cell : cells)
+		if (std::vector<uint32_t> const* cell_entries = grid.GetCellEntries(cell))
+			entries.insert(entries.end(), cell_entries->begin(), cell_entries->end());
+	std::sort(entries.begin(), entries.end());
+	entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+}
+
+// the candidates for a move, using the cells of the box enclosing the move
+static size_t CountEnclosingCandidates(chaos::TMParticleGrid const& grid, chaos::box2 const& src_box, glm::vec2 const& delta, std::vector<glm::ivec2>& cells, std::vector<uint32_t>& entries)
+{
+	chaos::box2 dst_box = src_box;
+	dst_box.position += delta;
+
+	std::pair<glm::ivec2, glm::ivec2> cell_range = grid.GetCellRange(src_box | dst_box);
+
+	cells.clear();
+	for (int y = cell_range.first.y; y <= cell_range.second.y; ++y)
+		for (int x = cell_range.first.x; x <= cell_range.second.x; ++x)
+			cells.push_back(glm::ivec2(x, y));
+	CollectEntries(grid, cells, entries);
+	return entries.size();
+}
+
+// the candidates for a move, using the cells crossed by the moving box
+static size_t CountSweptCandidates(chaos::TMParticleGrid const& grid, chaos::box2 const& src_box, glm::vec2 const& delta, std::vector<glm::ivec2>& cells, std::vector<uint32_t>& entries)
+{
+	cells.clear();
+	if (!grid.GetSweptCells(src_box, delta, cells, grid.GetEntryCount()))
+		return grid.GetEntryCount();
+	CollectEntries(grid, cells, entries);
+	return entries.size();
+}
+
+template<typename COUNT_FUNC>
+static double MeasureTicks(chaos::TMParticleGrid const& grid, std::vector<MovingBody> bodies, glm::vec2 const& world_size, size_t tick_count, size_t& candidate_count, COUNT_FUNC const& count_func)
+{
+	float delta_time = 1.0f / 60.0f;
+
+	std::vector<glm::ivec2> cells;
+	std::vector<uint32_t> entries;
+
+	candidate_count = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t tick = 0; tick < tick_count; ++tick)
+	{
+		for (MovingBody& body : bodies)
+		{
+			glm::vec2 delta = body.velocity * delta_time;
+			candidate_count += count_func(grid, body.box, delta, cells, entries);
+
+			// move the body and stay in the world
+			body.box.position += delta;
+			for (int axis = 0; axis < 2; ++axis)
+				if (body.box.position[axis] < 0.0f || body.box.position[axis] > world_size[axis])
+					body.velocity[axis] = -body.velocity[axis];
+		}
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(tick_count);
+}
+
+// a 256 x 256 tile world where a quarter of the tiles are filled
+static chaos::shared_ptr<chaos::ParticleLayerBase> CreateTileParticleLayer(glm::ivec2 const & tile_count, glm::vec2 const & tile_size)
+{
+	std::mt19937 random_generator(12345);
+
+	chaos::shared_ptr<chaos::ParticleLayerBase> result = new chaos::ParticleLayer<chaos::TMParticleLayerTrait>();
+
+	std::vector<chaos::box2> tile_boxes;
+	for (int y = 0; y < tile_count.y; ++y)
+		for (int x = 0; x < tile_count.x; ++x)
+			if (random_generator() % 4 == 0)
+				tile_boxes.push_back(chaos::box2((glm::vec2(x, y) + glm::vec2(0.5f, 0.5f)) * tile_size, tile_size * 0.5f));
+
+	result->SpawnParticles(tile_boxes.size()).Process([&tile_boxes](chaos::ParticleAccessor<chaos::TMParticle> accessor)
+	{
+		size_t i = 0;
+		for (chaos::TMParticle& particle : accessor)
+			particle.bounding_box = tile_boxes[i++];
+	});
+	return result;
+}
+
+// the bodies (a little smaller than a tile)
+static std::vector<MovingBody> CreateBodies(size_t body_count, float max_speed, glm::vec2 const & world_size, glm::vec2 const & tile_size)
+{
+	std::mt19937 random_generator(54321);
+
+	std::vector<MovingBody> result(body_count);
+	for (MovingBody& body : result)
+	{
+		body.box.position = { RandomFloat(random_generator, 0.0f, world_size.x), RandomFloat(random_generator, 0.0f, world_size.y) };
+		body.box.half_size = tile_size * 0.4f;
+		body.velocity = { RandomFloat(random_generator, -max_speed, max_speed), RandomFloat(random_generator, -max_speed, max_speed) };
+	}
+	return result;
+}
+
+static void BenchmarkBroadPhase(size_t body_count, float max_speed, size_t tick_count)
+{
+	glm::ivec2 tile_count = { 256, 256 };
+	glm::vec2 tile_size = { 32.0f, 32.0f };
+	glm::vec2 world_size = glm::vec2(tile_count) * tile_size;
+
+	chaos::shared_ptr<chaos::ParticleLayerBase> particle_layer = CreateTileParticleLayer(tile_count, tile_size);
+
+	chaos::TMParticleGrid grid;
+	grid.SetCellSize(tile_size);
+	grid.Update(particle_layer.get());
+
+	std::vector<MovingBody> bodies = CreateBodies(body_count, max_speed, world_size, tile_size);
+
+	size_t enclosing_candidates = 0;
+	double enclosing_duration = MeasureTicks(grid, bodies, world_size, tick_count, enclosing_candidates, CountEnclosingCandidates);
+
+	size_t swept_candidates = 0;
+	double swept_duration = MeasureTicks(grid, bodies, world_size, tick_count, swept_candidates, CountSweptCandidates);
+
+	double move_count = double(body_count * tick_count);
+
+	std::cout << "broad phase | bodies: " << body_count << " | speed: " << (max_speed / 60.0f / tile_size.x) << " tiles/tick"
+		<< " | enclosing box: " << enclosing_duration << " ms/tick (" << (double(enclosing_candidates) / move_count) << " candidates)"
+		<< " | swept cells: " << swept_duration << " ms/tick (" << (double(swept_candidates) / move_count) << " candidates)" << std::endl;
+}
+
+static void BenchmarkRun(size_t body_count, float max_speed, size_t tick_count)
+{
+	glm::ivec2 tile_count = { 256, 256 };
+	glm::vec2 tile_size = { 32.0f, 32.0f };
+	glm::vec2 world_size = glm::vec2(tile_count) * tile_size;
+	glm::vec2 box_extend = { 2.0f, 2.0f };
+
+	uint64_t collision_mask = 1;
+
+	// the minimal level instance required by TileCollisionComputer
+	chaos::shared_ptr<chaos::TMLevel> level = new chaos::TMLevel;
+	level->Initialize(new BenchmarkMap);
+
+	chaos::shared_ptr<BenchmarkLevelInstance> level_instance = new BenchmarkLevelInstance(level.get());
+	level_instance->AddLayerInstance(new BenchmarkLayerInstance(level_instance.get(), CreateTileParticleLayer(tile_count, tile_size).get(), tile_size, collision_mask));
+
+	std::vector<MovingBody> bodies = CreateBodies(body_count, max_speed, world_size, tile_size);
+
+	float delta_time = 1.0f / 60.0f;
+
+	size_t contact_count = 0;
+	size_t reaction_count = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (size_t tick = 0; tick < tick_count; ++tick)
+	{
+		for (MovingBody& body : bodies)
+		{
+			chaos::box2 dst_box = body.box;
+			dst_box.position += body.velocity * delta_time;
+
+			chaos::TileCollisionComputer computer = chaos::TileCollisionComputer(level_instance.get(), body.box, dst_box, int(collision_mask), nullptr, box_extend, nullptr);
+
+			chaos::box2 new_box = computer.Run([&computer, &contact_count, &reaction_count](chaos::TileCollisionInfo const& collision_info)
+			{
+				++contact_count;
+				bool result = computer.ComputeReaction(collision_info, [](chaos::TileCollisionInfo const& collision_info, chaos::Edge edge)
+				{
+					return true;
+				});
+				if (result)
+					++reaction_count;
+				return result;
+			});
+
+			// bounce against the tiles and stay in the world
+			for (int axis = 0; axis < 2; ++axis)
+			{
+				if (new_box.position[axis] != dst_box.position[axis])
+					body.velocity[axis] = -body.velocity[axis];
+				if ((new_box.position[axis] < 0.0f && body.velocity[axis] < 0.0f) || (new_box.position[axis] > world_size[axis] && body.velocity[axis] > 0.0f))
+					body.velocity[axis] = -body.velocity[axis];
+			}
+			body.box = new_box;
+		}
+	}
+	double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / double(tick_count);
+
+	double move_count = double(body_count * tick_count);
+
+	std::cout << "Run | bodies: " << body_count << " | speed: " << (max_speed / 60.0f / tile_size.x) << " tiles/tick"
+		<< " | " << duration << " ms/tick"
+		<< " | contacts: " << (double(contact_count) / move_count) << "/move"
+		<< " | reactions: " << (double(reaction_count) / move_count) << "/move" << std::endl;
+}
+
+int main(int argc, char ** argv, char ** env)
+{
+	chaos::WinTools::AllocConsoleAndRedirectStdOutput();
+
+	// from slow walkers to bodies crossing several tiles each tick
+	for (float max_speed : { 60.0f, 600.0f, 3000.0f, 6000.0f })
+		BenchmarkBroadPhase(10000, max_speed, 60);
+	// the whole computation : broad phase, time of impact sort and reaction
+	for (float max_speed : { 60.0f, 600.0f, 3000.0f, 6000.0f })
+		BenchmarkRun(10000, max_speed, 60);
+
+	chaos::WinTools::PressToContinue();
+
+	return 0;
+}
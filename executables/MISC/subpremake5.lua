@@ -3,24 +3,36 @@
 -- =============================================================================
 
 build:ProcessSubPremake("Atlas")
+build:ProcessSubPremake("AtlasBuildCacheBenchmark")
+build:ProcessSubPremake("AtlasPackingBenchmark")
 build:ProcessSubPremake("BufferPolicy")
 build:ProcessSubPremake("ClientServer")
 build:ProcessSubPremake("CRC32")
 build:ProcessSubPremake("CutWord")
+build:ProcessSubPremake("DistanceTransformBenchmark")
 build:ProcessSubPremake("ClassManager")
+build:ProcessSubPremake("ConcurrentObjectPoolBenchmark")
 build:ProcessSubPremake("FadeVortexImage")
 build:ProcessSubPremake("GenerateTexture")
+build:ProcessSubPremake("JSONCacheBenchmark")
 build:ProcessSubPremake("JSONTest")
+build:ProcessSubPremake("LogBenchmark")
+build:ProcessSubPremake("MapFileBenchmark")
 build:ProcessSubPremake("Metaprogramming")
 build:ProcessSubPremake("MyBase64")
 build:ProcessSubPremake("MyZLib")
+build:ProcessSubPremake("ObjectRequestIndexBenchmark")
+build:ProcessSubPremake("ObjectPoolBenchmark")
 build:ProcessSubPremake("OpenCV")
 build:ProcessSubPremake("OpenFileMap")
+build:ProcessSubPremake("PixelConversionBenchmark")
 build:ProcessSubPremake("OVR")
 build:ProcessSubPremake("RedirectOutput_Console")
+build:ProcessSubPremake("SceneTransformBenchmark")
 build:ProcessSubPremake("Screenshot")
 build:ProcessSubPremake("SkyBoxConversion")
 build:ProcessSubPremake("SkyBoxLoading")
 build:ProcessSubPremake("SparseBuffer")
+build:ProcessSubPremake("TileCollisionBenchmark")
 build:ProcessSubPremake("WindowsApp")
 build:ProcessSubPremake("ConfigurationTest")
\ No newline at end of file
@@ -146,7 +146,18 @@ namespace chaos
 			/** gets an info by name/tag */
 			character_type const* GetCharacterInfo(ObjectRequest request) const
 			{
-				return request.FindObject(elements);
+				return element_request_index.FindObject(request, elements);
+			}
+
+			/** build the index used to search the characters (must be called after the elements are modified) */
+			void BuildIndices()
+			{
+				element_request_index.Build(elements);
+			}
+			/** the index is not valid anymore (must be called whenever the elements are modified) */
+			void InvalidateIndices()
+			{
+				element_request_index.Invalidate();
 			}
 
 		public:
@@ -164,6 +175,8 @@ namespace chaos
 
 			/** the glyph contained in the character info */
 			std::vector<character_stored_type> elements;
+			/** the index to search the glyphs */
+			ObjectRequestIndex element_request_index;
 		};
 
 		/**
@@ -192,10 +205,10 @@ namespace chaos
 			using bitmap_stored_type = typename boost::mpl::apply<meta_wrapper_type, bitmap_type>::type;
 			using font_stored_type = typename boost::mpl::apply<meta_wrapper_type, font_type>::type;
 
-#define CHAOS_IMPL_GETINFO(result_type, funcname, vector_name, constness)\
+#define CHAOS_IMPL_GETINFO(result_type, funcname, vector_name, index_name, constness)\
 			result_type constness * funcname(ObjectRequest request, bool recursive = false) constness\
 			{\
-				result_type constness * result = request.FindObject(vector_name);\
+				result_type constness * result = index_name.FindObject(request, vector_name);\
 				if (result != nullptr)\
 					return result;\
 				size_t count = folders.size();\
@@ -203,22 +216,46 @@ namespace chaos
 					result = folders[i]->funcname(request, recursive);\
 				return result;\
 			}
-			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, const);
+			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, bitmap_request_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(bitmap_type, GetBitmapInfo, bitmaps, bitmap_request_index, const);
 
-			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, const);
+			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, font_request_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(font_type, GetFontInfo, fonts, font_request_index, const);
 
-			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, BOOST_PP_EMPTY());
-			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, const);
+			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, folder_request_index, BOOST_PP_EMPTY());
+			CHAOS_IMPL_GETINFO(folder_type, GetFolderInfo, folders, folder_request_index, const);
 #undef CHAOS_IMPL_GETINFO
 
+			/** build the indices used to search the bitmaps, fonts and folders (must be called after the content is modified) */
+			void BuildIndices(bool recursive = true)
+			{
+				bitmap_request_index.Build(bitmaps);
+				font_request_index.Build(fonts);
+				folder_request_index.Build(folders);
+				for (auto& font : fonts)
+					meta::get_raw_pointer(font)->BuildIndices();
+				if (recursive)
+					for (auto& folder : folders)
+						folder->BuildIndices(recursive);
+			}
+
+			/** the indices of this folder are not valid anymore (must be called whenever the bitmaps, fonts or folders are modified) */
+			void InvalidateIndices()
+			{
+				bitmap_request_index.Invalidate();
+				font_request_index.Invalidate();
+				folder_request_index.Invalidate();
+			}
+
 			/** clear the content of the folder */
 			void Clear()
 			{
 				bitmaps.clear();
 				fonts.clear();
 				folders.clear();
+				bitmap_request_index.Clear();
+				font_request_index.Clear();
+				folder_request_index.Clear();
 			}
 
 		public:
@@ -229,6 +266,13 @@ namespace chaos
 			std::vector<bitmap_stored_type> bitmaps;
 			/** the fonts contained in this folder */
 			std::vector<font_stored_type> fonts;
+
+			/** the index to search the bitmaps */
+			ObjectRequestIndex bitmap_request_index;
+			/** the index to search the fonts */
+			ObjectRequestIndex font_request_index;
+			/** the index to search the sub folders */
+			ObjectRequestIndex folder_request_index;
 		};
 
 		/**
@@ -431,8 +475,8 @@ namespace chaos
 
 			/** load an atlas from an index file */
 			bool LoadAtlas(FilePathParam const& path);
-			/** function to save the results */
-			bool SaveAtlas(FilePathParam const& path) const;
+			/** function to save the results (the bitmaps the cache marks as unchanged are not written again if their file is untouched) */
+			bool SaveAtlas(FilePathParam const& path, AtlasBuildCache* build_cache = nullptr) const;
 
 			/** returns the bitmaps contained in the atlas */
 			std::vector<bitmap_ptr> const& GetBitmaps() const { return bitmaps; }
@@ -442,7 +486,7 @@ namespace chaos
 			/** load an atlas from a json object */
 			bool LoadAtlas(nlohmann::json const * json, boost::filesystem::path const& src_dir);
 			/** function to save bitmaps */
-			bool SaveAtlasBitmaps(boost::filesystem::path const& target_dir, boost::filesystem::path const& index_filename, boost::filesystem::path const& bitmap_filename) const;
+			bool SaveAtlasBitmaps(boost::filesystem::path const& target_dir, boost::filesystem::path const& index_filename, boost::filesystem::path const& bitmap_filename, AtlasBuildCache* build_cache) const;
 			/** function to save contents */
 			bool SaveAtlasIndex(boost::filesystem::path const& target_dir, boost::filesystem::path const& index_filename, boost::filesystem::path const& bitmap_filename) const;
 			/** split a filename into DIRECTORY, INDEX_FILENAME and BITMAP prefix path */
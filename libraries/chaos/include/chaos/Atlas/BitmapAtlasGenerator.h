@@ -4,13 +4,31 @@ namespace chaos
 	{
 #ifdef CHAOS_FORWARD_DECLARATION
 
+		enum class AtlasPackingAlgorithm;
 		class AtlasGeneratorParams;
 		class Rectangle;
+		class AtlasBuildCache;
 		class AtlasGenerator;
 		class TextureArrayAtlasGenerator;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+		/**
+		* AtlasPackingAlgorithm : the method used to place the bitmaps in the atlas pages
+		*/
+
+		enum class CHAOS_API AtlasPackingAlgorithm : int
+		{
+			/** test every corner created by previous insertions (slow with many bitmaps) */
+			CORNERS,
+			/** place the bitmaps on the lowest position of the skyline of each page */
+			SKYLINE,
+			/** keep the maximal free rectangles of each page and use the one with the best short side fit */
+			MAX_RECTS
+		};
+
+		CHAOS_DECLARE_ENUM_METHOD(AtlasPackingAlgorithm, CHAOS_API);
+
 		/**
 		* AtlasGeneratorParams : parameters used when generating an atlas
 		*/
@@ -46,6 +64,8 @@ namespace chaos
 			int atlas_max_height = 0;
 			/** some padding for the bitmap : should be even */
 			int atlas_padding = 0;
+			/** the algorithm used to place the bitmaps (SKYLINE by default, the atlases were generated with CORNERS before. Set CORNERS to get the previous layouts) */
+			AtlasPackingAlgorithm packing_algorithm = AtlasPackingAlgorithm::SKYLINE;
 			/** the background color */
 			glm::vec4 background_color = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
 			/** parameters for merging different pixel format */
@@ -80,23 +100,157 @@ namespace chaos
 			bool IsIntersecting(Rectangle const& big) const;
 		};
 
+		/**
+		* AtlasBuildCache : the result of a previous generation, used to rebuild an atlas incrementally
+		*   the source files are identified by the hash of their content, their path and their manifest (the image processors).
+		*     The processed images are stored in the image directory so that unchanged sources do not need to be decoded again
+		*   the bitmaps are identified by the hash of their pixels (so that renaming a file does not change the placement)
+		*   while the parameters (filters included) and the size of the atlas do not change, an unchanged bitmap keeps its previous position
+		*   and the pages whose content is the same as before do not need to be saved again (as long as their file has not been modified)
+		*/
+
+		class CHAOS_API AtlasBuildCache
+		{
+			/** JSON saving method */
+			friend CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache const& src);
+			/** JSON loading method */
+			friend CHAOS_API bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache& dst);
+
+		public:
+
+			/** a bitmap placed by the previous generation */
+			class Entry
+			{
+			public:
+				/** the hash of the pixels */
+				uint64_t content_hash = 0;
+				/** the page of the bitmap */
+				int bitmap_index = -1;
+				/** the position of the bitmap (padding excluded) */
+				int x = 0;
+				/** the position of the bitmap (padding excluded) */
+				int y = 0;
+				/** the size of the bitmap */
+				int width = 0;
+				/** the size of the bitmap */
+				int height = 0;
+			};
+
+			/** a source whose processed images are stored in the image directory */
+			class SourceEntry
+			{
+			public:
+				/** the key of the source (see ComputeSourceKey(...)) */
+				uint64_t source_key = 0;
+				/** the number of processed images */
+				int image_count = 0;
+				/** the animation of the bitmap */
+				ImageAnimationDescription animation_description;
+				/** whether the source has been used since the cache has been loaded (not serialized) */
+				bool used = false;
+			};
+
+			/** constructor */
+			AtlasBuildCache() = default;
+			/** no copy constructor (mutex) */
+			AtlasBuildCache(AtlasBuildCache const& src) = delete;
+
+			/** load the cache from a file */
+			bool LoadCache(FilePathParam const& path);
+			/** save the cache into a file */
+			bool SaveCache(FilePathParam const& path) const;
+
+			/** get the hash of the parameters used for the previous generation */
+			uint64_t GetParamsHash() const { return params_hash; }
+			/** get the bitmaps of the previous generation */
+			std::vector<Entry> const& GetEntries() const { return entries; }
+			/** replace the previous generation with a new one (the pages whose hash did not change are flagged unchanged) */
+			void SetGeneration(uint64_t in_params_hash, std::vector<Entry> in_entries, std::vector<uint64_t> in_page_hashes);
+
+			/** returns whether a page is the same as the one of the previous generation and whether its file still has the content saved by the cache */
+			bool IsPageUnchanged(size_t index, FilePathParam const& path) const;
+			/** record the content of the file where a page has been saved */
+			void SetPageFile(size_t index, FilePathParam const& path);
+
+			/** set the directory where the processed images are stored (empty to disable the cache for the images) */
+			void SetImageDirectory(boost::filesystem::path const& in_image_directory) { image_directory = in_image_directory; }
+			/** get the directory where the processed images are stored */
+			boost::filesystem::path const& GetImageDirectory() const { return image_directory; }
+
+			/** compute the key of the source of a bitmap (from the content of its files, not their dates) */
+			static uint64_t ComputeSourceKey(BitmapFileLoadData const& load_data);
+			/** get the processed images of a source (thread safe) */
+			bool LoadSourceImages(uint64_t source_key, std::vector<FIBITMAP*>& images, ImageAnimationDescription& animation_description);
+			/** store the processed images of a source (thread safe) */
+			bool SaveSourceImages(uint64_t source_key, std::vector<FIBITMAP*> const& images, ImageAnimationDescription const& animation_description);
+			/** remove the sources (and their files) that have not been used since the cache has been loaded */
+			void RemoveUnusedSources();
+
+		protected:
+
+			/** get the path of a processed image */
+			boost::filesystem::path GetSourceImagePath(uint64_t source_key, int image_index) const;
+
+		protected:
+
+			/** the hash of the parameters used for the generation */
+			uint64_t params_hash = 0;
+			/** the bitmaps of the generation */
+			std::vector<Entry> entries;
+			/** the hash of the content of each page */
+			std::vector<uint64_t> page_hashes;
+			/** the hash of the file where each page has been saved */
+			std::vector<uint64_t> page_file_hashes;
+			/** the sources whose processed images are stored */
+			std::vector<SourceEntry> sources;
+			/** the pages of the last generation that are the same as the ones of the generation before (not serialized) */
+			std::vector<bool> unchanged_pages;
+			/** the directory where the processed images are stored (not serialized) */
+			boost::filesystem::path image_directory;
+			/** the index of each source in the vector (not serialized) */
+			std::unordered_map<uint64_t, size_t> source_indices;
+			/** the mutex protecting the sources (images are loaded in parallel) */
+			boost::mutex sources_mutex;
+		};
+
 		/**
 		* AtlasGenerator :
-		*   each time a BitmapInfo is inserted, the space is split along 4 axis
-		*   this creates a grid of points that serve to new positions for inserting next entries ...
-		*   it select the best position as the one that minimize space at left, right, top and bottom
+		*   bitmaps are sorted by decreasing surface and inserted one by one in the first page where they fit
+		*   the position inside a page depends on AtlasGeneratorParams::packing_algorithm
+		*
+		*   CORNERS   : each time a BitmapInfo is inserted, 3 new corners are added. Each corner is tested against all inserted rectangles
+		*   SKYLINE   : the top of the used area is a list of horizontal segments. The bitmap is placed where its top is the lowest
+		*   MAX_RECTS : the free space is a set of maximal rectangles (possibly overlapping). The bitmap goes in the one that wastes the less space
 		*/
 
 		class CHAOS_API AtlasGenerator
 		{
-			/** an definition is a set of vertical and horizontal lines that split the space */
+			/** an horizontal segment of the skyline */
+			class SkylineSegment
+			{
+			public:
+				/** the left of the segment */
+				int x = 0;
+				/** the height of the used space over the segment */
+				int y = 0;
+				/** the width of the segment */
+				int width = 0;
+			};
+
+			/** an definition is the state of the packing of one page */
 			class AtlasDefinition
 			{
 			public:
 				unsigned int surface_sum = 0;
 
+				/** CORNERS: the inserted rectangles */
 				std::vector<Rectangle>  collision_rectangles;
+				/** CORNERS: the positions to be tested */
 				std::vector<glm::ivec2> potential_bottomleft_corners;
+				/** SKYLINE: the segments sorted by x, covering the whole width */
+				std::vector<SkylineSegment> skyline;
+				/** MAX_RECTS: the maximal free rectangles */
+				std::vector<Rectangle> free_rectangles;
 			};
 
 			/** an utility class used to reference all entries in input */
@@ -110,9 +264,14 @@ namespace chaos
 			bool ComputeResult(AtlasInput const& in_input, Atlas& in_ouput, AtlasGeneratorParams const& in_params = AtlasGeneratorParams());
 			/** returns a vector with all generated bitmaps (to be deallocated after usage) */
 			std::vector<bitmap_ptr> GenerateBitmaps(BitmapInfoInputVector const& entries, PixelFormat const& final_pixel_format) const;
-			/** create an atlas from a directory into another directory */
+			/** create an atlas from a directory into another directory (a build cache is stored beside the atlas to make next calls incremental) */
 			static bool CreateAtlasFromDirectory(FilePathParam const& bitmaps_dir, FilePathParam const& path, bool recursive, AtlasGeneratorParams const& in_params = AtlasGeneratorParams());
 
+			/** use the result of a previous generation and update it (nullptr to disable). If the input uses the same cache, its unused sources are removed after a successful generation */
+			void SetBuildCache(AtlasBuildCache* in_build_cache) { build_cache = in_build_cache; }
+			/** get the build cache */
+			AtlasBuildCache* GetBuildCache() const { return build_cache; }
+
 		protected:
 
 			/** clear the results */
@@ -133,11 +292,34 @@ namespace chaos
 
 			/** the effective function to do the computation */
 			bool DoComputeResult(BitmapInfoInputVector const& entries);
+			/** place the entries that did not change at their previous position */
+			void ReuseCachedPositions(BitmapInfoInputVector const& entries, std::vector<bool>& placed);
+			/** remove the pages without any entry */
+			void RemoveEmptyAtlasDefinitions(BitmapInfoInputVector const& entries);
+			/** compute the hash of the parameters and of each entry */
+			void ComputeHashes(BitmapInfoInputVector const& entries, PixelFormat const& final_pixel_format);
+			/** store the result of the generation into the build cache */
+			void UpdateBuildCache(BitmapInfoInputVector const& entries);
+			/** initialize a new page */
+			void InitializeAtlasDefinition(AtlasDefinition& atlas_def) const;
 			/** returns the position (if any) in an atlas withe the best score */
 			float FindBestPositionInAtlas(BitmapInfoInputVector const& entries, BitmapInfoInput const& info, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
 			/** insert a bitmap in an atlas definition */
 			void InsertBitmapLayoutInAtlas(BitmapLayout& layout, AtlasDefinition& atlas_def, glm::ivec2 const& position);
 
+			/** CORNERS: search a position for the rectangle (padding included) */
+			bool FindCornerPosition(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** CORNERS: update the page after an insertion */
+			void InsertCornerRectangle(Rectangle const& r, AtlasDefinition& atlas_def) const;
+			/** SKYLINE: search a position for the rectangle (padding included) */
+			bool FindSkylinePosition(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** SKYLINE: update the page after an insertion */
+			void InsertSkylineRectangle(Rectangle const& r, AtlasDefinition& atlas_def) const;
+			/** MAX_RECTS: search a position for the rectangle (padding included) */
+			bool FindMaxRectsPosition(Rectangle const& r, AtlasDefinition const& atlas_def, glm::ivec2& position) const;
+			/** MAX_RECTS: update the page after an insertion */
+			void InsertMaxRectsRectangle(Rectangle const& r, AtlasDefinition& atlas_def) const;
+
 			/** an utility function that returns an array with 0.. count - 1*/
 			static std::vector<size_t> CreateIndexTable(size_t count)
 			{
@@ -166,6 +348,12 @@ namespace chaos
 			Atlas* output = nullptr;
 			/** all definitions */
 			std::vector<AtlasDefinition> atlas_definitions;
+			/** the result of the previous generation */
+			AtlasBuildCache* build_cache = nullptr;
+			/** the hash of the parameters */
+			uint64_t params_hash = 0;
+			/** the hash of the pixels of each entry */
+			std::vector<uint64_t> content_hashes;
 		};
 
 		/**
@@ -188,6 +376,19 @@ namespace chaos
 		/** save into JSON */
 		CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, AtlasGeneratorParams const& src);
 
+		/** load from JSON */
+		CHAOS_API bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache::Entry& dst);
+		/** save into JSON */
+		CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache::Entry const& src);
+		/** load from JSON */
+		CHAOS_API bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache::SourceEntry& dst);
+		/** save into JSON */
+		CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache::SourceEntry const& src);
+		/** load from JSON */
+		CHAOS_API bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache& dst);
+		/** save into JSON */
+		CHAOS_API bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache const& src);
+
 
 #endif
 
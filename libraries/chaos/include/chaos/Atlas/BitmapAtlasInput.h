@@ -11,6 +11,7 @@ namespace chaos
 		class CharacterInfoInput;
 		class FontInfoInput;
 		class AddFilesToFolderData;
+		class BitmapFileLoadData;
 		class FolderInfoInput;
 		class AtlasInput;
 
@@ -166,6 +167,33 @@ namespace chaos
 		};
 
 
+		/**
+		* BitmapFileLoadData : a bitmap file whose manifest has been found, but that is still to be loaded (so that several files can be loaded in parallel)
+		*/
+
+		class CHAOS_API BitmapFileLoadData
+		{
+		public:
+
+			/** the path of the image file */
+			boost::filesystem::path path;
+			/** if not empty, all the images in this directory are the frames of the bitmap (the path is the manifest one) */
+			boost::filesystem::path frames_directory;
+			/** the name of the bitmap */
+			std::string name;
+			/** the tag of the bitmap */
+			TagType tag = 0;
+			/** the manifest (if any) */
+			nlohmann::json json_manifest;
+			/** the cache where the processed images may be found (if any) */
+			AtlasBuildCache* build_cache = nullptr;
+
+			/** the loaded and processed images */
+			std::vector<FIBITMAP*> images;
+			/** the animation of the bitmap */
+			ImageAnimationDescription animation_description;
+		};
+
 		/**
 		* FolderInfoInput :  this info will produced in the final Atlas a FolderInfo
 		*/
@@ -214,8 +242,12 @@ namespace chaos
 
 			/** internal method to add a bitmap from file (and searching manifest) */
 			BitmapInfoInput* AddBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data);
-			/** internal method to add a bitmap whose manifest (or not) is known */
-			BitmapInfoInput* AddBitmapFileWithManifestImpl(FilePathParam const& path, char const* name, TagType tag, nlohmann::json const* json_manifest, std::vector<FIBITMAP*>* images);
+			/** internal method to search the manifest of a bitmap file and its name (no image is loaded) */
+			bool PrepareBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data, BitmapFileLoadData& load_data) const;
+			/** internal method to load the images of a bitmap file and apply its processors. May be called from any thread */
+			static bool LoadBitmapFileImpl(BitmapFileLoadData& load_data);
+			/** internal method to insert a bitmap that has been loaded */
+			BitmapInfoInput* InsertBitmapFileImpl(BitmapFileLoadData& load_data);
 			/** internal method to add a bitmap or a multi bitmap */
 			BitmapInfoInput* AddBitmapImpl(std::vector<FIBITMAP*> pages, char const* name, TagType tag, ImageAnimationDescription const* animation_description);
 
@@ -283,6 +315,11 @@ namespace chaos
 				TagType tag,
 				FontInfoInputParams const& params = FontInfoInputParams());
 
+			/** set the cache used to skip decoding and processing of the unchanged bitmap files */
+			void SetBuildCache(AtlasBuildCache* in_build_cache) { build_cache = in_build_cache; }
+			/** get the cache used for the bitmap files */
+			AtlasBuildCache* GetBuildCache() const { return build_cache; }
+
 		protected:
 
 			/** register bitmap */
@@ -304,6 +341,9 @@ namespace chaos
 			std::vector<library_ptr> libraries; // XXX : order declaration of 'libraries' and 'faces' is important
 			/** the ft_faces to destroy */      //       'faces' have to be destroyed first. So it must be declared last
 			std::vector<face_ptr> faces;
+
+			/** the cache used for the bitmap files */
+			AtlasBuildCache* build_cache = nullptr;
 		};
 
 
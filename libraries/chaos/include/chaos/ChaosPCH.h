@@ -65,6 +65,7 @@
 #include <future>
 #include <chrono>
 #include <forward_list>
+#include <deque>
 #include <type_traits>
 
 // boost is full of #pragma comment(lib, ...)
@@ -78,6 +79,8 @@
 #include <boost/atomic.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/timer/timer.hpp>
 #include <boost/program_options/option.hpp>
 #include <boost/program_options/options_description.hpp>
@@ -204,6 +204,36 @@ namespace chaos
 			std::swap(bufsize, other.bufsize);
 		}
 
+		// XXX : a buffer of const elements can be built from a buffer of mutable elements. Both have the same layout, so the policy of
+		//       the mutable buffer can handle the const one
+
+		/** conversion constructor (from a buffer of mutable elements) */
+		template<typename OTHER_TYPE, typename = std::enable_if_t<std::is_same_v<TYPE, OTHER_TYPE const> && !std::is_same_v<TYPE, OTHER_TYPE>>>
+		Buffer(Buffer<OTHER_TYPE> const& other)
+		{
+			if (other.GetPolicy() == nullptr) // buffer is unmanaged => simple copy
+			{
+				data = other.data;
+				bufsize = other.bufsize;
+			}
+			else
+			{
+				CopyFromBuffer(&other);
+			}
+		}
+
+		/** conversion move constructor (from a buffer of mutable elements) */
+		template<typename OTHER_TYPE, typename = std::enable_if_t<std::is_same_v<TYPE, OTHER_TYPE const> && !std::is_same_v<TYPE, OTHER_TYPE>>>
+		Buffer(Buffer<OTHER_TYPE>&& other) noexcept
+		{
+			policy = other.GetPolicy();
+			data = other.data;
+			bufsize = other.bufsize;
+			other.SetPolicy(nullptr);
+			other.data = nullptr;
+			other.bufsize = 0;
+		}
+
 		/** get the size */
 		size_t size() const
 		{
@@ -26,8 +26,8 @@ namespace chaos
 	class ClockCreateParams;
 	class Clock;
 
-	/** events ordered by start time */
-	using ClockEventTickSet = std::set<ClockEventTickRegistration, ClockEventTickSort>;
+	/** events to tick during a frame (sorted by start time before being triggered) */
+	using ClockEventTickSet = std::vector<ClockEventTickRegistration>;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
@@ -281,10 +281,14 @@ namespace chaos
 		int execution_count = 0;
 		/** the clock it belongs to */
 		class Clock* clock = nullptr;
+		/** the index of the event in the clock (in active_events or dormant_events) */
+		size_t clock_index = 0;
+		/** whether the event is waiting for its start time in the heap of the clock */
+		bool dormant = false;
 	};
 
 	/**
-	* ClockEventTickSort : used to sort events by start time
+	* ClockEventTickSort : used to sort events by start time (events with the same start time keep their registration order)
 	*/
 
 	class CHAOS_API ClockEventTickSort
@@ -399,6 +403,16 @@ namespace chaos
 		bool TickClockImpl(float delta_time, double cumulated_factor, ClockEventTickSet& event_tick_set);
 		/** internal methods to trigger all the event */
 		void TriggerClockEvent(ClockEventTickRegistration& registered_event);
+		/** register an event in the active list or in the heap depending on its start time */
+		void InsertEvent(ClockEvent* clock_event);
+		/** unregister an event from the active list or from the heap */
+		void DetachEvent(ClockEvent* clock_event);
+		/** move the dormant events whose start time is reached into the active list */
+		void WakeDormantEvents(double time);
+		/** restore the heap property for an element moving towards the root */
+		void SiftDormantEventUp(size_t index);
+		/** restore the heap property for an element moving towards the leaves */
+		void SiftDormantEventDown(size_t index);
 		/** ensure given clock is a child of the hierarchy tree */
 		bool IsDescendantClock(Clock const* child_clock) const;
 
@@ -417,8 +431,15 @@ namespace chaos
 		/** the name of the clock */
 		std::string name;
 
-		/** the events */
-		std::vector<shared_ptr<ClockEvent>> pending_events;
+		// XXX : an event whose start time is not reached cannot be ticked, nor be too late.
+		//       Such events wait in a binary heap (ordered by start time) instead of being checked every tick
+
+		/** the events that are checked every tick */
+		std::vector<shared_ptr<ClockEvent>> active_events;
+		/** the events waiting for their start time (min-heap on start_time) */
+		std::vector<shared_ptr<ClockEvent>> dormant_events;
+		/** the registrations of a tick (the buffer is kept to avoid allocations) */
+		ClockEventTickSet tick_registrations;
 		/** the child clocks */
 		std::vector<shared_ptr<Clock>> children_clocks;
 	};
@@ -0,0 +1,444 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	template<typename T>
+	class ConcurrentObjectPool;
+
+	template<typename T>
+	class ObjectPoolThreadCache;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* This is an ObjectPool that can be shared between threads. It is lock-free :
+	*   - the objects are stored in ConcurrentObjectPool64 nodes whose bitfields are atomic
+	*   - nodes are pushed in front of a singly linked list with a CAS and are never removed until the pool is destroyed (no ABA problem, the list can be walked at any time)
+	*   - nodes are allocated by blocks aligned on their size so that the owning block (and then node) of an object is found by masking its address
+	*   - inside a block, nodes are only aligned on a cache line, so a node never takes more memory than its size rounded to a cache line
+	* The memory of the nodes is kept until the pool is destroyed.
+	* Threads that allocate a lot may use an ObjectPoolThreadCache that works by batches (a batch takes or gives back many objects of a node with a single atomic operation)
+	**/
+	template<typename T>
+	class ConcurrentObjectPool
+	{
+	public:
+
+		using type = T;
+
+		/** a node of the pool */
+		class node_type : public ConcurrentObjectPool64<T>
+		{
+		public:
+
+			/** the next node in the list (written once before the node is published) */
+			node_type* next_node = nullptr;
+		};
+
+		/** the header of a block of nodes */
+		class block_type
+		{
+		public:
+
+			/** the next block in the list */
+			block_type* next_block = nullptr;
+		};
+
+		/** the size of a cache line (two nodes never share one) */
+		static constexpr size_t cache_line_size = 64;
+		/** the minimum number of nodes in a block (the memory lost at the end of a block is lower than one node) */
+		static constexpr size_t min_nodes_per_block = 8;
+
+		/** constructor */
+		ConcurrentObjectPool() = default;
+		/** no copy constructor */
+		ConcurrentObjectPool(ConcurrentObjectPool const& src) = delete;
+		/** no copy operator */
+		ConcurrentObjectPool& operator = (ConcurrentObjectPool const& src) = delete;
+
+		/** destructor (no other thread must use the pool anymore) */
+		~ConcurrentObjectPool()
+		{
+			node_type* node = head_node.load(boost::memory_order_acquire);
+			while (node != nullptr)
+			{
+				node_type* next_node = node->next_node;
+				node->~node_type();
+				node = next_node;
+			}
+			block_type* block = head_block.load(boost::memory_order_acquire);
+			while (block != nullptr)
+			{
+				block_type* next_block = block->next_block;
+				DestroyBlock(block);
+				block = next_block;
+			}
+		}
+
+		/** release an object inside the pool for further usage */
+		void Free(type* object)
+		{
+			if (object != nullptr)
+			{
+				node_type* node = GetOwningNode(object);
+				node->SetObjectLive(object, false);
+				// manually call the destructor
+				object->~type();
+				DoRelease(node, object);
+			}
+		}
+
+		/** allocate a new object from pool */
+		template<typename ...PARAMS>
+		type* Allocate(PARAMS ...params)
+		{
+			node_type* node = nullptr;
+			type* result = DoReserve(node);
+			if (result == nullptr)
+				return nullptr;
+			// manually call constructor
+			new (result) type(std::forward<PARAMS>(params)...);
+			node->SetObjectLive(result, true);
+			return result;
+		}
+
+		/** reserve the memory for an object (no constructor is called) */
+		type* Reserve()
+		{
+			node_type* node = nullptr;
+			return DoReserve(node);
+		}
+
+		/** release the memory of an object (no destructor is called) */
+		void Release(type* object)
+		{
+			if (object != nullptr)
+				DoRelease(GetOwningNode(object), object);
+		}
+
+		/** reserve the memory for several objects at once (no constructor is called). Each node gives all it can with a single atomic operation. Returns the number of objects reserved */
+		size_t ReserveBatch(type** result, size_t count)
+		{
+			assert(result != nullptr || count == 0);
+
+			size_t reserved = 0;
+			// try the last node where some memory has been seen available
+			node_type* node = hint_node.load(boost::memory_order_acquire);
+			if (node != nullptr)
+				reserved += DoReserveBatch(node, result, count);
+			// walk the list (unless we know there is no room left)
+			if (reserved < count && available_count.load(boost::memory_order_relaxed) > 0)
+				for (node = head_node.load(boost::memory_order_acquire); node != nullptr && reserved < count; node = node->next_node)
+					reserved += DoReserveBatch(node, result + reserved, count - reserved);
+			// need new nodes
+			while (reserved < count)
+			{
+				type* object = DoReserve(node);
+				if (object == nullptr)
+					break;
+				result[reserved++] = object;
+				reserved += DoReserveBatch(node, result + reserved, count - reserved);
+			}
+			return reserved;
+		}
+
+		/** release the memory of several objects at once (no destructor is called). The objects of a same node that follow each other are released with a single atomic operation */
+		void ReleaseBatch(type* const* objects, size_t count)
+		{
+			assert(objects != nullptr || count == 0);
+
+			node_type* node = nullptr;
+			size_t released = 0;
+			size_t first = 0;
+			while (first < count)
+			{
+				if (objects[first] == nullptr)
+				{
+					++first;
+					continue;
+				}
+				node = GetOwningNode(objects[first]);
+				size_t last = first + 1;
+				while (last < count && objects[last] != nullptr && GetOwningNode(objects[last]) == node)
+					++last;
+				node->ReleaseBatch(objects + first, last - first);
+				released += last - first;
+				first = last;
+			}
+			if (released > 0)
+			{
+				available_count.fetch_add(int64_t(released), boost::memory_order_relaxed);
+				// avoid writing the shared hint when it does not change
+				if (hint_node.load(boost::memory_order_relaxed) != node)
+					hint_node.store(node, boost::memory_order_release);
+			}
+		}
+
+		/** mark an object that has been reserved and constructed by the caller as live (so that the pool destroys it) */
+		void SetObjectLive(type const* object, bool live)
+		{
+			assert(object != nullptr);
+			GetOwningNode(object)->SetObjectLive(object, live);
+		}
+
+	protected:
+
+		/** gets the alignment of the nodes inside a block */
+		static constexpr size_t GetNodeAlignment()
+		{
+			return std::max(alignof(node_type), cache_line_size);
+		}
+
+		/** gets the distance between two nodes of a block */
+		static constexpr size_t GetNodeStride()
+		{
+			return (sizeof(node_type) + GetNodeAlignment() - 1) & ~(GetNodeAlignment() - 1);
+		}
+
+		/** gets the offset of the first node of a block */
+		static constexpr size_t GetFirstNodeOffset()
+		{
+			return (sizeof(block_type) + GetNodeAlignment() - 1) & ~(GetNodeAlignment() - 1);
+		}
+
+		/** gets the size (and alignment) of the blocks : a power of 2 that contains at least min_nodes_per_block nodes */
+		static constexpr size_t GetBlockSize()
+		{
+			size_t result = GetNodeAlignment();
+			while (result < GetFirstNodeOffset() + min_nodes_per_block * GetNodeStride())
+				result *= 2;
+			return result;
+		}
+
+		/** gets the number of nodes in a block */
+		static constexpr size_t GetNodesPerBlock()
+		{
+			return (GetBlockSize() - GetFirstNodeOffset()) / GetNodeStride();
+		}
+
+		/** gets a node of a block */
+		static node_type* GetBlockNode(block_type* block, size_t index)
+		{
+			assert(index < GetNodesPerBlock());
+			return reinterpret_cast<node_type*>(reinterpret_cast<char*>(block) + GetFirstNodeOffset() + index * GetNodeStride());
+		}
+
+		/** gets the node an object belongs to */
+		static node_type* GetOwningNode(type const* object)
+		{
+			uintptr_t address = reinterpret_cast<uintptr_t>(object);
+			uintptr_t block_address = address & ~uintptr_t(GetBlockSize() - 1);
+			node_type* result = GetBlockNode(reinterpret_cast<block_type*>(block_address), (address - block_address - GetFirstNodeOffset()) / GetNodeStride());
+			assert(result->IsObjectInsidePool(object));
+			return result;
+		}
+
+		/** reserve the memory for several objects in a given node */
+		size_t DoReserveBatch(node_type* node, type** result, size_t count)
+		{
+			if (count == 0)
+				return 0;
+			size_t reserved = node->ReserveBatch(result, count);
+			if (reserved > 0)
+			{
+				available_count.fetch_sub(int64_t(reserved), boost::memory_order_relaxed);
+				// avoid writing the shared hint when it does not change
+				if (hint_node.load(boost::memory_order_relaxed) != node)
+					hint_node.store(node, boost::memory_order_release);
+			}
+			return reserved;
+		}
+
+		/** reserve the memory for an object and get the node it belongs to */
+		type* DoReserve(node_type*& node)
+		{
+			// try the last node where some memory has been seen available
+			node = hint_node.load(boost::memory_order_acquire);
+			if (node != nullptr)
+			{
+				if (type* result = node->Reserve())
+				{
+					available_count.fetch_sub(1, boost::memory_order_relaxed);
+					return result;
+				}
+			}
+			// walk the list (unless we know there is no room left)
+			if (available_count.load(boost::memory_order_relaxed) > 0)
+			{
+				for (node = head_node.load(boost::memory_order_acquire); node != nullptr; node = node->next_node)
+				{
+					if (type* result = node->Reserve())
+					{
+						available_count.fetch_sub(1, boost::memory_order_relaxed);
+						hint_node.store(node, boost::memory_order_release);
+						return result;
+					}
+				}
+			}
+			// need new nodes : reserve an object before they become visible to other threads
+			block_type* block = CreateBlock();
+			if (block == nullptr)
+				return nullptr;
+			node = GetBlockNode(block, 0);
+			type* result = node->Reserve();
+			assert(result != nullptr);
+			available_count.fetch_add(int64_t(GetNodesPerBlock() * node_type::pool_size) - 1, boost::memory_order_relaxed);
+
+			// splice the chain of nodes of the block in front of the list with a single CAS
+			node_type* last_node = GetBlockNode(block, GetNodesPerBlock() - 1);
+			last_node->next_node = head_node.load(boost::memory_order_acquire);
+			while (!head_node.compare_exchange_weak(last_node->next_node, node, boost::memory_order_acq_rel, boost::memory_order_acquire));
+			hint_node.store(node, boost::memory_order_release);
+			return result;
+		}
+
+		/** release the memory of an object that belongs to a node */
+		void DoRelease(node_type* node, type* object)
+		{
+			node->Release(object);
+			available_count.fetch_add(1, boost::memory_order_relaxed);
+			// avoid writing the shared hint when it does not change
+			if (hint_node.load(boost::memory_order_relaxed) != node)
+				hint_node.store(node, boost::memory_order_release);
+		}
+
+		/** create a block aligned on its size, with all its nodes chained together */
+		block_type* CreateBlock()
+		{
+			void* memory = ::operator new(GetBlockSize(), std::align_val_t(GetBlockSize()), std::nothrow);
+			if (memory == nullptr)
+				return nullptr;
+			block_type* result = new (memory) block_type();
+			for (size_t i = GetNodesPerBlock(); i > 0; --i)
+			{
+				node_type* node = new (GetBlockNode(result, i - 1)) node_type();
+				if (i < GetNodesPerBlock())
+					node->next_node = GetBlockNode(result, i);
+			}
+			// push the block in front of the list of blocks
+			result->next_block = head_block.load(boost::memory_order_acquire);
+			while (!head_block.compare_exchange_weak(result->next_block, result, boost::memory_order_acq_rel, boost::memory_order_acquire));
+			return result;
+		}
+
+		/** destroy a block (its nodes must have been destroyed) */
+		void DestroyBlock(block_type* block)
+		{
+			block->~block_type();
+			::operator delete(block, std::align_val_t(GetBlockSize()));
+		}
+
+	protected:
+
+		/** the list of nodes (nodes are only pushed in front) */
+		boost::atomic<node_type*> head_node{ nullptr };
+		/** the list of blocks (only used to free the memory) */
+		boost::atomic<block_type*> head_block{ nullptr };
+		/** the last node where some memory has been seen available */
+		boost::atomic<node_type*> hint_node{ nullptr };
+		/** the number of objects that can be reserved without a new node (the result may be outdated as soon as it is read) */
+		boost::atomic<int64_t> available_count{ 0 };
+	};
+
+	/**
+	* A per-thread magazine in front of a ConcurrentObjectPool.
+	* Allocations and releases are done in a local array, the shared pool is only accessed to refill or flush the magazine by batches.
+	* The cache is not thread-safe itself: create one for each thread. It must be destroyed before the pool.
+	* Objects may be allocated by a cache and freed by another one.
+	**/
+	template<typename T>
+	class ObjectPoolThreadCache
+	{
+	public:
+
+		using type = T;
+
+		/** the default number of objects exchanged with the shared pool at once */
+		static constexpr size_t default_magazine_size = 32;
+
+		/** constructor */
+		ObjectPoolThreadCache(ConcurrentObjectPool<T>& in_pool, size_t in_magazine_size = default_magazine_size) :
+			pool(in_pool),
+			magazine_size(std::max(in_magazine_size, size_t(1)))
+		{
+			magazine.reserve(2 * magazine_size);
+		}
+		/** no copy constructor */
+		ObjectPoolThreadCache(ObjectPoolThreadCache const& src) = delete;
+		/** no copy operator */
+		ObjectPoolThreadCache& operator = (ObjectPoolThreadCache const& src) = delete;
+
+		/** destructor */
+		~ObjectPoolThreadCache()
+		{
+			Flush();
+		}
+
+		/** release an object for further usage */
+		void Free(type* object)
+		{
+			if (object != nullptr)
+			{
+				pool.SetObjectLive(object, false);
+				// manually call the destructor
+				object->~type();
+				magazine.push_back(object);
+				// the magazine is full : give half of it back to the shared pool
+				if (magazine.size() >= 2 * magazine_size)
+				{
+					size_t first = magazine.size() - magazine_size;
+					pool.ReleaseBatch(&magazine[first], magazine_size);
+					magazine.resize(first);
+				}
+			}
+		}
+
+		/** allocate a new object */
+		template<typename ...PARAMS>
+		type* Allocate(PARAMS ...params)
+		{
+			// the magazine is empty : refill it from the shared pool
+			if (magazine.size() == 0)
+			{
+				magazine.resize(magazine_size);
+				magazine.resize(pool.ReserveBatch(&magazine[0], magazine_size));
+				if (magazine.size() == 0)
+					return nullptr;
+			}
+			type* result = magazine.back();
+			magazine.pop_back();
+			// manually call constructor
+			new (result) type(std::forward<PARAMS>(params)...);
+			pool.SetObjectLive(result, true);
+			return result;
+		}
+
+		/** give all cached memory back to the shared pool */
+		void Flush()
+		{
+			if (magazine.size() > 0)
+			{
+				pool.ReleaseBatch(&magazine[0], magazine.size());
+				magazine.clear();
+			}
+		}
+
+		/** get the number of objects currently cached */
+		size_t GetCachedCount() const
+		{
+			return magazine.size();
+		}
+
+	protected:
+
+		/** the shared pool */
+		ConcurrentObjectPool<T>& pool;
+		/** the number of objects exchanged with the shared pool at once */
+		size_t magazine_size = default_magazine_size;
+		/** the memory reserved in the shared pool, not used by any object */
+		std::vector<type*> magazine;
+	};
+
+#endif
+
+}; // namespace chaos
@@ -0,0 +1,219 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	template<typename T>
+	class ConcurrentObjectPool64;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* This is a lock-free version of ObjectPool64 : the bitfield of used instances is atomic so that several threads may allocate and free concurrently
+	**/
+	template<typename T>
+	class ConcurrentObjectPool64
+	{
+
+	public:
+
+		using type = T;
+
+		static constexpr size_t pool_size = 64;
+
+		/** constructor */
+		ConcurrentObjectPool64() = default;
+		/** no copy constructor */
+		ConcurrentObjectPool64(ConcurrentObjectPool64 const& src) = delete;
+		/** no copy operator */
+		ConcurrentObjectPool64& operator = (ConcurrentObjectPool64 const& src) = delete;
+
+		/** destructor (no other thread must use the pool anymore) */
+		~ConcurrentObjectPool64()
+		{
+			// destroy all constructed objects (memory that has only been reserved is not touched)
+			BitTools::ForEachBitForward(live_instanced.load(boost::memory_order_acquire), [this](int64_t index)
+			{
+				GetObjectPtr(index)->~type();
+			});
+		}
+
+		/** release an object inside the pool for further usage */
+		void Free(type* object)
+		{
+			if (object != nullptr)
+			{
+				SetObjectLive(object, false);
+				// manually call the destructor
+				object->~type();
+				Release(object);
+			}
+		}
+
+		/** allocate a new object from pool */
+		template<typename ...PARAMS>
+		type* Allocate(PARAMS ...params)
+		{
+			type* result = Reserve();
+			if (result == nullptr)
+				return nullptr;
+			// manually call constructor
+			new (result) type(std::forward<PARAMS>(params)...);
+			SetObjectLive(result, true);
+			return result;
+		}
+
+		/** reserve the memory for an object (no constructor is called) */
+		type* Reserve()
+		{
+			int64_t used = used_instanced.load(boost::memory_order_relaxed);
+			while (used != int64_t(-1))
+			{
+				// try to get the bit (on failure, used is updated with the current value)
+				int64_t index = BitTools::bsr(~used);
+				if (used_instanced.compare_exchange_weak(used, BitTools::SetBit(used, index, true), boost::memory_order_acquire, boost::memory_order_relaxed))
+				{
+					reserved_count.fetch_add(1, boost::memory_order_relaxed);
+					return GetObjectPtr(index);
+				}
+			}
+			return nullptr;
+		}
+
+		/** reserve the memory for several objects with a single atomic operation (no constructor is called). Returns the number of objects reserved */
+		size_t ReserveBatch(type** result, size_t count)
+		{
+			assert(result != nullptr || count == 0);
+
+			int64_t used = used_instanced.load(boost::memory_order_relaxed);
+			while (used != int64_t(-1) && count > 0)
+			{
+				// take as many free bits as possible (on failure, used is updated with the current value)
+				uint64_t available = ~uint64_t(used);
+				uint64_t mask = 0;
+				size_t reserved = 0;
+				while (available != 0 && reserved < count)
+				{
+					uint64_t bit = available & (~available + 1); // the lowest available bit
+					mask |= bit;
+					available &= ~bit;
+					++reserved;
+				}
+				if (used_instanced.compare_exchange_weak(used, used | int64_t(mask), boost::memory_order_acquire, boost::memory_order_relaxed))
+				{
+					reserved_count.fetch_add(reserved, boost::memory_order_relaxed);
+					size_t i = 0;
+					BitTools::ForEachBitForward(int64_t(mask), [this, result, &i](int64_t index)
+					{
+						result[i++] = GetObjectPtr(index);
+					});
+					return reserved;
+				}
+			}
+			return 0;
+		}
+
+		/** release the memory of several objects of this pool with a single atomic operation (no destructor is called) */
+		void ReleaseBatch(type* const* objects, size_t count)
+		{
+			assert(objects != nullptr || count == 0);
+
+			int64_t mask = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				assert(objects[i] != nullptr);
+				assert(IsObjectInsidePool(objects[i]));
+				int64_t index = GetObjectIndex(objects[i]);
+				assert(((live_instanced.load(boost::memory_order_relaxed) >> index) & 1) == 0); // a constructed object must be destroyed with Free(...)
+				assert(((mask >> index) & 1) == 0); // an object appears twice
+				mask |= (int64_t(1) << index);
+			}
+			if (mask == 0)
+				return;
+			reserved_count.fetch_sub(count, boost::memory_order_relaxed);
+			int64_t previous_used = used_instanced.fetch_and(~mask, boost::memory_order_release);
+			assert((previous_used & mask) == mask); // ensure no object was already freed
+		}
+
+		/** release the memory of an object (no destructor is called) */
+		void Release(type* object)
+		{
+			assert(object != nullptr);
+			assert(IsObjectInsidePool(object));
+			// update the available flag
+			int64_t index = GetObjectIndex(object);
+			assert(((live_instanced.load(boost::memory_order_relaxed) >> index) & 1) == 0); // a constructed object must be destroyed with Free(...)
+			reserved_count.fetch_sub(1, boost::memory_order_relaxed);
+			int64_t previous_used = used_instanced.fetch_and(~(int64_t(1) << index), boost::memory_order_release);
+			assert((previous_used >> index) & 1); // ensure the object was not already freed
+		}
+
+		/** check whether an object is inside the pool */
+		bool IsObjectInsidePool(type const* object) const
+		{
+			assert(object != nullptr);
+			return (object >= GetObjectPtr(0)) && (object <= GetObjectPtr(pool_size - 1));
+		}
+
+		/** returns true whether all instanced have allready been allocated (the result may be outdated as soon as it is returned) */
+		bool HasAvailableInstanceLeft() const
+		{
+			return (used_instanced.load(boost::memory_order_relaxed) != int64_t(-1));
+		}
+
+		/** gets the number of reserved object (the result may be outdated as soon as it is returned) */
+		size_t GetReservedCount() const
+		{
+			return reserved_count.load(boost::memory_order_relaxed);
+		}
+
+		/** mark an object as constructed or destroyed (the objects reserved and constructed by the caller may be marked so that the pool destroys them) */
+		void SetObjectLive(type const* object, bool live)
+		{
+			assert(IsObjectInsidePool(object));
+			int64_t index = GetObjectIndex(object);
+			assert((used_instanced.load(boost::memory_order_relaxed) >> index) & 1);
+			if (live)
+				live_instanced.fetch_or(int64_t(1) << index, boost::memory_order_release);
+			else
+				live_instanced.fetch_and(~(int64_t(1) << index), boost::memory_order_release);
+		}
+
+	protected:
+
+		/** gets the index of an object inside the pool */
+		int64_t GetObjectIndex(type const* object) const
+		{
+			assert(object != nullptr);
+			return int64_t(object - GetObjectPtr(0));
+		}
+
+		/** gets the address of an object inside the pool */
+		T const* GetObjectPtr(int64_t index) const
+		{
+			assert(index >= 0);
+			assert(index < pool_size);
+			return ((type*)data) + index;
+		}
+
+		/** gets the address of an object inside the pool */
+		T* GetObjectPtr(int64_t index)
+		{
+			assert(index >= 0);
+			assert(index < pool_size);
+			return ((type*)data) + index;
+		}
+
+	protected:
+
+		/** a bitfield indicating with instances are in use */
+		boost::atomic<int64_t> used_instanced{ 0 };
+		/** a bitfield indicating with instances have been constructed (a subset of used_instanced) */
+		boost::atomic<int64_t> live_instanced{ 0 };
+		/** number of reserved object */
+		boost::atomic<size_t> reserved_count{ 0 };
+		/** the block of data where instanced are being used */
+		alignas(8) char data[pool_size * sizeof(T)];
+	};
+
+#endif
+}; // namespace chaos
@@ -0,0 +1,119 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	template<typename T>
+	class ConcurrentRingBuffer;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ConcurrentRingBuffer : a bounded lock-free queue for several producers and several consumers
+	*
+	* Each cell has a sequence number telling whether it is ready to be written (sequence == position)
+	* or ready to be read (sequence == position + 1). Producers and consumers reserve a position with a CAS.
+	* The capacity is rounded up to a power of 2.
+	**/
+
+	template<typename T>
+	class ConcurrentRingBuffer
+	{
+	public:
+
+		using type = T;
+
+		/** constructor */
+		ConcurrentRingBuffer(size_t in_capacity)
+		{
+			size_t capacity = 2;
+			while (capacity < in_capacity)
+				capacity *= 2;
+			mask = capacity - 1;
+			cells.reset(new Cell[capacity]);
+			for (size_t i = 0; i < capacity; ++i)
+				cells[i].sequence.store(i, boost::memory_order_relaxed);
+		}
+		/** no copy constructor */
+		ConcurrentRingBuffer(ConcurrentRingBuffer const& src) = delete;
+		/** no copy operator */
+		ConcurrentRingBuffer& operator = (ConcurrentRingBuffer const& src) = delete;
+
+		/** get the number of cells */
+		size_t GetCapacity() const { return mask + 1; }
+
+		/** insert an element at the end of the queue. Returns false whether the queue is full */
+		bool TryPush(type&& value)
+		{
+			Cell* cell = nullptr;
+			size_t position = enqueue_position.load(boost::memory_order_relaxed);
+			while (true)
+			{
+				cell = &cells[position & mask];
+				size_t sequence = cell->sequence.load(boost::memory_order_acquire);
+				intptr_t difference = intptr_t(sequence) - intptr_t(position);
+				if (difference == 0)
+				{
+					if (enqueue_position.compare_exchange_weak(position, position + 1, boost::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0) // the cell has not been read since the previous turn
+					return false;
+				else
+					position = enqueue_position.load(boost::memory_order_relaxed);
+			}
+			cell->value = std::move(value);
+			cell->sequence.store(position + 1, boost::memory_order_release);
+			return true;
+		}
+
+		/** extract the element at the beginning of the queue. Returns false whether the queue is empty */
+		bool TryPop(type& result)
+		{
+			Cell* cell = nullptr;
+			size_t position = dequeue_position.load(boost::memory_order_relaxed);
+			while (true)
+			{
+				cell = &cells[position & mask];
+				size_t sequence = cell->sequence.load(boost::memory_order_acquire);
+				intptr_t difference = intptr_t(sequence) - intptr_t(position + 1);
+				if (difference == 0)
+				{
+					if (dequeue_position.compare_exchange_weak(position, position + 1, boost::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0) // the cell has not been written yet
+					return false;
+				else
+					position = dequeue_position.load(boost::memory_order_relaxed);
+			}
+			result = std::move(cell->value);
+			cell->sequence.store(position + mask + 1, boost::memory_order_release);
+			return true;
+		}
+
+	protected:
+
+		/** an entry of the buffer */
+		class Cell
+		{
+		public:
+
+			/** the state of the cell */
+			boost::atomic<size_t> sequence{ 0 };
+			/** the stored value */
+			type value;
+		};
+
+		/** the cells */
+		std::unique_ptr<Cell[]> cells;
+		/** the capacity minus one */
+		size_t mask = 0;
+		/** the next position to write (on its own cache line to avoid false sharing with the readers) */
+		alignas(64) boost::atomic<size_t> enqueue_position{ 0 };
+		/** the next position to read */
+		alignas(64) boost::atomic<size_t> dequeue_position{ 0 };
+	};
+
+#endif
+
+}; // namespace chaos
@@ -43,6 +43,7 @@
 #include "chaos/Core/ImGuiHelpObject.h"
 #include "chaos/Core/ImGuiGlobalVariablesObject.h"
 #include "chaos/Core/ImGuiDemoObject.h"
+#include "chaos/Core/ConcurrentRingBuffer.h"
 #include "chaos/Core/Log.h"
 #include "chaos/Core/FileResource.h"
 #include "chaos/Core/Tag.h"
@@ -66,4 +67,9 @@
 #include "chaos/Core/NestedIterator.h"
 #include "chaos/Core/ImGuiLogObject.h"
 #include "chaos/Core/ObjectPool.h"
-#include "chaos/Core/ObjectPool64.h"
\ No newline at end of file
+#include "chaos/Core/ObjectPool64.h"
+#include "chaos/Core/ConcurrentObjectPool64.h"
+#include "chaos/Core/ConcurrentObjectPool.h"
+#include "chaos/Core/JobManager.h"
+#include "chaos/Core/Profiler.h"
+#include "chaos/Core/ImGuiProfilerObject.h"
\ No newline at end of file
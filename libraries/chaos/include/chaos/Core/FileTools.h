@@ -49,6 +49,8 @@ namespace chaos
 		CHAOS_API bool IsTypedFile(FilePathParam const& path, char const* expected_ext);
 		/** loading a whole file into memory */
 		CHAOS_API Buffer<char> LoadFile(FilePathParam const& path, LoadFileFlag flags = LoadFileFlag::NONE);
+		/** map a whole file into memory without copy (the content is read-only). ASCII files (that require a null terminator) and empty files are loaded instead */
+		CHAOS_API Buffer<char const> MapFile(FilePathParam const& path, LoadFileFlag flags = LoadFileFlag::NONE);
 
 		/** try path redirection and call func (until it returns true) */
 		CHAOS_API bool WithFile(FilePathParam const& path, LightweightFunction<bool(boost::filesystem::path const& p)> func);
@@ -25,6 +25,9 @@ namespace chaos
 		/** override */
 		virtual void OnDrawImGuiMenu(BeginImGuiMenuFunc begin_menu_func) override;
 
+		/** draw a row of the table (the first line of a group of identical lines) */
+		void DrawLine(LogLine const& line, size_t group_count, size_t index);
+
 	protected:
 
 		/** the logger object to display */
@@ -0,0 +1,34 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ImGuiProfilerObject;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	* ImGuiProfilerObject: a drawable that displays the statistics of the profiler zones
+	*/
+
+	class ImGuiProfilerObject : public ImGuiObject
+	{
+	public:
+
+		CHAOS_DECLARE_OBJECT_CLASS(ImGuiProfilerObject, ImGuiObject);
+
+	protected:
+
+		/** override */
+		virtual void OnDrawImGuiContent() override;
+		/** override */
+		virtual void OnDrawImGuiMenu(BeginImGuiMenuFunc begin_menu_func) override;
+
+	protected:
+
+		/** a filter for the zone names */
+		ImGuiTextFilter filter;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
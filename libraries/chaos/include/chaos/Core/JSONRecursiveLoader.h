@@ -13,6 +13,17 @@ namespace chaos
 	// -any string (excluding keys for objects)   "@@XXX" is escaped into "XXX"
 	//
 	// -any string (excluding keys for objects)   "@XXX" is replaced into "PATH_OF_CURRENT_SUBJSON_FILE/XXX"
+	//
+	// Note on cache.
+	//
+	// -once a file has been fully resolved, the result is stored in a binary file (CBOR) in the user local temp directory
+	//  with the list of all files implied (path, last write time, size and a hash of the content for the small files)
+	//
+	// -the last write time only has a resolution of one second : the content hash detects a file modified twice in the same second with the same size
+	//
+	// -the next loadings of the same file use the cache as long as none of these files has changed
+	//
+	// -the cache is disabled with the command line flag -NoJSONCache
 
 	class CHAOS_API JSONRecursiveLoader
 	{
@@ -27,6 +38,19 @@ namespace chaos
 			std::vector<nlohmann::json*> to_replaced_nodes;
 		};
 
+		class DependencyEntry
+		{
+		public:
+			/** the path of the file */
+			boost::filesystem::path path;
+			/** the last write time of the file (-1 if the file does not exist) */
+			int64_t write_time = -1;
+			/** the size of the file */
+			uint64_t file_size = 0;
+			/** a hash of the content of the file (0 for the files that are too large to be hashed) */
+			uint64_t content_hash = 0;
+		};
+
 	public:
 
 		/** entry point to parse recursively a JSON file from its path */
@@ -55,6 +79,15 @@ namespace chaos
 		/** internal method */
 		void Clear();
 
+		/** internal method */
+		static DependencyEntry GetDependencyEntry(boost::filesystem::path const& path);
+		/** internal method */
+		static boost::filesystem::path GetCachePath(boost::filesystem::path const& path);
+		/** internal method */
+		bool LoadFromCache(boost::filesystem::path const& path, boost::filesystem::path const& cache_path, nlohmann::json& result) const;
+		/** internal method */
+		bool SaveIntoCache(boost::filesystem::path const& path, boost::filesystem::path const& cache_path, nlohmann::json const& json) const;
+
 		/** internal method */
 		LoaderEntry* FindEntry(FilePathParam const& path);
 		/** internal method */
@@ -72,6 +105,8 @@ namespace chaos
 		std::vector<LoaderEntry*> entries;
 		/** a value to detect for infinite recursion */
 		std::vector<LoaderEntry*> stacked_entries;
+		/** all the files read (or tried) during the loading */
+		std::vector<DependencyEntry> dependencies;
 	};
 
 #endif
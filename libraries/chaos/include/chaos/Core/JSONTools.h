@@ -105,6 +105,8 @@ namespace chaos
 	{
 		/** parsing a JSON file (catch exceptions) */
 		CHAOS_API bool Parse(char const* buffer, nlohmann::json& result);
+		/** parsing a JSON file from a buffer that is not null terminated (catch exceptions) */
+		CHAOS_API bool Parse(char const* buffer, size_t size, nlohmann::json& result);
 		/** parsing a JSON file from a buffer (load any dependant files) */
 		CHAOS_API bool ParseRecursive(char const* buffer, boost::filesystem::path const& config_path, nlohmann::json& result, LoadFileFlag flag = LoadFileFlag::NONE);
 		/** Load a JSON file in a recursive whay */
@@ -0,0 +1,112 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class JobManager;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/**
+	 * JobManager: a singleton owning a set of worker threads that execute jobs
+	 *
+	 * While no worker is started, everything is executed on the calling thread.
+	 * A thread waiting for some jobs to complete executes pending jobs of the same group too, so that ParallelFor(...) may be nested.
+	 * It never executes unrelated jobs (that could be long, like a texture decoding) while waiting.
+	 */
+
+	class CHAOS_API JobManager : public Singleton<JobManager>
+	{
+	public:
+
+		/** destructor */
+		~JobManager();
+
+		/** start the worker threads (by default, one per core minus the calling thread) */
+		void StartWorkers(std::optional<size_t> count = {});
+		/** wait for pending jobs, then stop all the worker threads */
+		void StopWorkers();
+		/** get the number of worker threads */
+		size_t GetWorkerCount() const;
+
+		/** push a job to be executed by any worker (executed immediately if there is no worker). Group 0 is for jobs that belong to no group */
+		void PushJob(std::function<void()> job, uint64_t group = 0);
+		/** get a new identifier for a group of jobs */
+		uint64_t NewJobGroup();
+		/** extract and execute a pending job of a given group (0 for any job) on the calling thread. Returns false whether there was none */
+		bool ExecutePendingJob(uint64_t group = 0);
+
+		/** call func(index) for each index in [0, count) using workers and the calling thread. Returns when all calls are over */
+		template<typename FUNC>
+		void ParallelFor(size_t count, FUNC const& func)
+		{
+			size_t helper_count = std::min(count, GetWorkerCount() + 1) - 1;
+			if (helper_count == 0)
+			{
+				for (size_t i = 0; i < count; ++i)
+					func(i);
+				return;
+			}
+
+			boost::atomic<size_t> next_index{ 0 };
+			boost::atomic<size_t> finished_helpers{ 0 };
+
+			uint64_t group = NewJobGroup();
+
+			auto ProcessIndices = [&next_index, count, &func]()
+			{
+				for (size_t i = next_index.fetch_add(1); i < count; i = next_index.fetch_add(1))
+					func(i);
+			};
+
+			// the helpers share the indices with the calling thread
+			for (size_t i = 0; i < helper_count; ++i)
+			{
+				PushJob([&ProcessIndices, &finished_helpers]()
+				{
+					ProcessIndices();
+					finished_helpers.fetch_add(1, boost::memory_order_release);
+				}, group);
+			}
+			ProcessIndices();
+
+			// the helpers reference local variables : wait for all of them (the ones that have not started yet are executed here)
+			while (finished_helpers.load(boost::memory_order_acquire) < helper_count)
+				if (!ExecutePendingJob(group))
+					std::this_thread::yield();
+		}
+
+	protected:
+
+		/** a job in the queue */
+		class PendingJob
+		{
+		public:
+
+			/** the function to execute */
+			std::function<void()> job;
+			/** the group the job belongs to */
+			uint64_t group = 0;
+		};
+
+		/** the loop of the workers */
+		void WorkerLoop();
+
+	protected:
+
+		/** the mutex protecting the queue */
+		mutable boost::mutex mutex;
+		/** the condition the workers are waiting on */
+		boost::condition_variable condition;
+		/** the pending jobs */
+		std::deque<PendingJob> pending_jobs;
+		/** the worker threads */
+		std::vector<std::thread> workers;
+		/** whether the workers are requested to stop */
+		bool stop_workers = false;
+		/** the last group identifier given */
+		boost::atomic<uint64_t> last_job_group{ 0 };
+	};
+
+#endif
+
+}; // namespace chaos
@@ -83,8 +83,10 @@ namespace chaos
 		virtual void OnAttachedToLogger(Logger* in_logger) {}
 		/** called whenever the listener is detached from the log object */
 		virtual void OnDetachedFromLogger(Logger* in_logger) {}
-		/** called whenever a new line is emitted from the log object */
+		/** called whenever a new line is emitted from the log object (from the logger's writer thread) */
 		virtual void OnNewLine(LogLine const& line) {}
+		/** called whenever the logger is flushed, once all pending lines have been handled */
+		virtual void OnFlush() {}
 
 	protected:
 
@@ -104,7 +106,7 @@ namespace chaos
 
 		/** get the log file path */
 		boost::filesystem::path GetOutputPath() const;
-		/** force flush to file */
+		/** force flush to file (the pending lines of the logger are written first) */
 		void Flush();
 
 	protected:
@@ -116,6 +118,8 @@ namespace chaos
 		/** override */
 		virtual void OnNewLine(LogLine const& line) override;
 		/** override */
+		virtual void OnFlush() override;
+		/** override */
 		virtual void DrawImGuiMenu() override;
 
 	protected:
@@ -128,6 +132,11 @@ namespace chaos
 
 	/**
 	* Logger : deserve to output some logs
+	*
+	* Lines may be emitted from any thread. They are formatted on the calling thread and pushed into a lock-free ring buffer.
+	* A writer thread extracts them, stores them (up to a maximum count) and notifies the listeners (so file writing never stalls the callers).
+	* Whenever the ring buffer is full, the calling thread dispatches the pending lines itself.
+	* Transactions are not thread-safe and should only be used by the main thread.
 	*/
 
 	class CHAOS_API Logger : public Object
@@ -138,6 +147,13 @@ namespace chaos
 
 	public:
 
+		/** the number of lines that can wait for the writer thread */
+		static constexpr size_t pending_line_capacity = 4096;
+		/** the default maximum number of lines kept in memory */
+		static constexpr size_t default_max_line_count = 10000;
+
+		/** constructor */
+		Logger();
 		/** destructor */
 		virtual ~Logger();
 
@@ -189,23 +205,30 @@ namespace chaos
 		/** whether a transaction is started */
 		bool IsTransactionInProgress() const;
 
-		/** get the entries */
-		std::vector<LogLine> const& GetLines() const
-		{
-			return GetInstance()->lines;
-		}
+		/** get a copy of the entries */
+		std::vector<LogLine> GetLines() const;
+		/** call a function on each entry without copying them (the lines are locked during the whole call, the function must not wait for another thread that logs) */
+		void ForEachLine(LightweightFunction<void(LogLine const&)> func) const;
+
+		/** wait until all pending lines have been handled by the listeners, then flush the listeners */
+		void Flush();
+
+		/** change the maximum number of lines kept in memory (no value for no limit) */
+		void SetMaxLineCount(std::optional<size_t> in_max_line_count);
+		/** get the maximum number of lines kept in memory */
+		std::optional<size_t> GetMaxLineCount() const;
 
 		/** get the number of listeners */
-		size_t GetListenerCount() const { return listeners.size(); }
+		size_t GetListenerCount() const;
 		/** get the nth listener */
-		LoggerListener* GetListener(size_t index) { return listeners[index].get(); }
+		LoggerListener* GetListener(size_t index);
 		/** get the nth listener */
-		LoggerListener const* GetListener(size_t index) const { return listeners[index].get(); }
+		LoggerListener const* GetListener(size_t index) const;
 
 		/** get the number of domains */
-		size_t GetDomainCount() const { return domains.size(); }
+		size_t GetDomainCount() const;
 		/** get a given domain */
-		char const * GetDomain(size_t index) const { return domains[index]->c_str(); }
+		char const * GetDomain(size_t index) const;
 
 	protected:
 
@@ -214,6 +237,11 @@ namespace chaos
 		/** remove a listener from the log */
 		void RemoveListener(LoggerListener* listener);
 
+		/** store the pending lines and notify the listeners */
+		void DispatchPendingLines();
+		/** the loop of the writer thread */
+		void WriterLoop();
+
 		/** internal method to format then display a log */
 		void DoFormatAndOutput(std::string_view domain, LogSeverity severity, char const* format, ...);
 		/** format a string and concat to the transaction in progress */
@@ -227,13 +255,42 @@ namespace chaos
 
 	protected:
 
+		/** the lines waiting for the writer thread */
+		ConcurrentRingBuffer<LogLine> pending_lines{ pending_line_capacity };
+		/** the number of lines pushed into the ring buffer */
+		boost::atomic<size_t> pushed_line_count{ 0 };
+
+		/** the mutex protecting the lines and the listeners (recursive because listeners may read the lines) */
+		mutable boost::recursive_mutex dispatch_mutex;
+		/** the condition to know when some lines have been dispatched */
+		boost::condition_variable_any dispatch_condition;
+		/** the number of lines that have been dispatched */
+		boost::atomic<size_t> dispatched_line_count{ 0 };
+		/** the thread dispatching the lines */
+		std::thread::id dispatching_thread;
 		/** the line displayed */
-		std::vector<LogLine> lines;
-		/** domains. store domains only once */
-		std::vector<std::string *> domains;
+		std::deque<LogLine> lines;
+		/** the maximum number of lines kept in memory */
+		std::optional<size_t> max_line_count = default_max_line_count;
 		/** listeners */
 		std::vector<shared_ptr<LoggerListener>> listeners;
 
+		/** the mutex protecting the domains */
+		mutable boost::shared_mutex domain_mutex;
+		/** domains. store domains only once */
+		std::vector<std::string *> domains;
+		/** the domains by name (the keys point to the strings of the domains vector) */
+		std::unordered_map<std::string_view, char const*> domain_map;
+
+		/** the mutex for the writer thread to wait on */
+		boost::mutex writer_mutex;
+		/** the condition to wake the writer thread */
+		boost::condition_variable writer_condition;
+		/** whether the writer thread is requested to stop */
+		boost::atomic<bool> stop_writer{ false };
+		/** the writer thread */
+		std::thread writer_thread;
+
 		/** whether a transaction is being started */
 		int transaction_count = 0;
 		/** the transaction information */
@@ -9,6 +9,11 @@ namespace chaos
 
 	/**
 	* This is an allocator that use in internal ObjectPool64
+	*
+	* Each node is registered into a lookup table so that Free(...) does not need to walk the lists.
+	* The key is the address of the node's data divided by the size of this data. Because the data of 2 nodes
+	* cannot overlap, a key references at most one node, and the node owning an object is either in the key
+	* of the object or in the previous one.
 	**/
 	template<typename T>
 	class ObjectPool
@@ -48,9 +53,11 @@ namespace chaos
 		~ObjectPool()
 		{
 			while (node_type* node = ExtractFirstNode(used_nodes))
-				delete(node);
+				DestroyNode(node);
 			while (node_type* node = ExtractFirstNode(unavailable_nodes))
-				delete(node);
+				DestroyNode(node);
+			while (node_type* node = ExtractFirstNode(unused_nodes))
+				DestroyNode(node);
 		}
 
 		/** release an object inside the pool for further usage */
@@ -58,34 +65,16 @@ namespace chaos
 		{
 			if (object != nullptr)
 			{
-				if (node_type* node = SearchOwningNode(used_nodes, object))
-				{
-					if (node->GetReservedCount() == 1) // the last object is about to be removed from the node. the node now belongs to unused
-					{
-						ExtractNode(used_nodes, node);
-						InsertNode(unused_nodes, node);
-						++unused_node_count;
-					}
-					node->Free(object);
-
-					// does this node deserve to be destroyed ?
-					if (max_unused_node_count.has_value() && unused_node_count > max_unused_node_count.value() && node->GetReservedCount() == 0)
-					{
-						ExtractNode(unused_nodes, node);
-						delete(node);
-						--unused_node_count;
-					}
-				}
-				else if (node_type* node = SearchOwningNode(unavailable_nodes, object))
-				{
-					ExtractNode(unavailable_nodes, node); // now, the node has a single available entry. it belongs to used_nodes
-					InsertNode(used_nodes, node);
-					node->Free(object);
-				}
-				else
+				node_type* node = SearchOwningNode(object);
+				if (node == nullptr)
 				{
 					assert(0); // object does not belong to this pool
+					return;
 				}
+				node->SetObjectLive(object, false);
+				// manually call the destructor
+				object->~type();
+				DoRelease(node, object);
 			}
 		}
 
@@ -93,36 +82,36 @@ namespace chaos
 		template<typename ...PARAMS>
 		type* Allocate(PARAMS ...params)
 		{
-			// try nodes used_nodes then unused_nodes (we want to keep unused_nodes untouched as long as possible)
-			if (used_nodes == nullptr)
+			node_type* node = nullptr;
+			type* result = DoReserve(node);
+			if (result == nullptr)
+				return nullptr;
+			// manually call constructor
+			new (result) type(std::forward<PARAMS>(params)...);
+			node->SetObjectLive(result, true);
+			return result;
+		}
+
+		/** release the memory of an object (no destructor is called) */
+		void Release(type* object)
+		{
+			if (object != nullptr)
 			{
-				// can use an unused_nodes
-				if (unused_nodes != nullptr)
+				node_type* node = SearchOwningNode(object);
+				if (node == nullptr)
 				{
-					InsertNode(used_nodes, ExtractFirstNode(unused_nodes));
-					--unused_node_count;
-				}
-				// need a new node
-				else if (node_type* new_node = new node_type)
-				{
-					InsertNode(used_nodes, new_node);
+					assert(0); // object does not belong to this pool
+					return;
 				}
-				// failure
-				else
-					return nullptr;
+				DoRelease(node, object);
 			}
+		}
 
-			assert(used_nodes != nullptr);
-
-			// allocate the object
-			if (type* result = used_nodes->Allocate(std::forward<PARAMS>(params)...))
-			{
-				// maybe the used_nodes has no more instance available. displace node to appropriate list
-				if (!used_nodes->HasAvailableInstanceLeft())
-					InsertNode(unavailable_nodes, ExtractFirstNode(used_nodes));
-				return result;
-			}
-			return nullptr;
+		/** reserve the memory for an object (no constructor is called) */
+		type* Reserve()
+		{
+			node_type* node = nullptr;
+			return DoReserve(node);
 		}
 
 		/** change the maximum number of unused nodes */
@@ -133,7 +122,7 @@ namespace chaos
 			{
 				while (unused_node_count > max_unused_node_count.value())
 				{
-					delete(ExtractFirstNode(unused_nodes));
+					DestroyNode(ExtractFirstNode(unused_nodes));
 					--unused_node_count;
 				}
 			}
@@ -201,6 +190,73 @@ namespace chaos
 
 	protected:
 
+		/** reserve the memory for an object and get the node it belongs to */
+		type* DoReserve(node_type*& node)
+		{
+			// try nodes used_nodes then unused_nodes (we want to keep unused_nodes untouched as long as possible)
+			if (used_nodes == nullptr)
+			{
+				// can use an unused_nodes
+				if (unused_nodes != nullptr)
+				{
+					InsertNode(used_nodes, ExtractFirstNode(unused_nodes));
+					--unused_node_count;
+				}
+				// need a new node
+				else if (node_type* new_node = CreateNode())
+				{
+					InsertNode(used_nodes, new_node);
+				}
+				// failure
+				else
+					return nullptr;
+			}
+
+			assert(used_nodes != nullptr);
+
+			// reserve the object
+			node = used_nodes;
+			if (type* result = used_nodes->Reserve())
+			{
+				// maybe the used_nodes has no more instance available. displace node to appropriate list
+				if (!used_nodes->HasAvailableInstanceLeft())
+					InsertNode(unavailable_nodes, ExtractFirstNode(used_nodes));
+				return result;
+			}
+			return nullptr;
+		}
+
+		/** release the memory of an object that belongs to a node */
+		void DoRelease(node_type* node, type* object)
+		{
+			assert(node->GetReservedCount() > 0);
+
+			if (node->HasAvailableInstanceLeft()) // the node belongs to used_nodes
+			{
+				if (node->GetReservedCount() == 1) // the last object is about to be removed from the node. the node now belongs to unused
+				{
+					ExtractNode(used_nodes, node);
+					InsertNode(unused_nodes, node);
+					++unused_node_count;
+				}
+				node->Release(object);
+
+				// does this node deserve to be destroyed ?
+				if (max_unused_node_count.has_value() && unused_node_count > max_unused_node_count.value() && node->GetReservedCount() == 0)
+				{
+					ExtractNode(unused_nodes, node);
+					DestroyNode(node);
+					--unused_node_count;
+				}
+			}
+			else // the node belongs to unavailable_nodes
+			{
+				ExtractNode(unavailable_nodes, node); // now, the node has a single available entry. it belongs to used_nodes
+				InsertNode(used_nodes, node);
+				node->Release(object);
+			}
+		}
+
 		/** remove a node from the list */
 		void ExtractNode(node_type*& root, node_type* node)
 		{
@@ -217,14 +273,39 @@ namespace chaos
 			node->previous_node = node->next_node = nullptr;
 		}
 
-		/** search a node that contains the object */
-		node_type* SearchOwningNode(node_type* node, type const* object)
+		/** get the key of an address in the lookup table */
+		static uintptr_t GetNodeKey(void const* address)
+		{
+			return uintptr_t(address) / (node_type::pool_size * sizeof(type));
+		}
+
+		/** create a new node and register it into the lookup table */
+		node_type* CreateNode()
+		{
+			node_type* result = new node_type;
+			if (result != nullptr)
+				node_lookup[GetNodeKey(result->GetObjectPtr(0))] = result;
+			return result;
+		}
+
+		/** unregister a node from the lookup table and destroy it */
+		void DestroyNode(node_type* node)
+		{
+			assert(node != nullptr);
+			node_lookup.erase(GetNodeKey(node->GetObjectPtr(0)));
+			delete(node);
+		}
+
+		/** search the node that contains the object */
+		node_type* SearchOwningNode(type const* object) const
 		{
-			while (node != nullptr)
+			uintptr_t key = GetNodeKey(object);
+			// the data of the node starts in the same key than the object or in the previous one
+			for (uintptr_t k : { key, key - 1 })
 			{
-				if (node->IsObjectInsidePool(object))
-					return node;
-				node = node->next_node;
+				auto it = node_lookup.find(k);
+				if (it != node_lookup.end() && it->second->IsObjectInsidePool(object))
+					return it->second;
 			}
 			return nullptr;
 		}
@@ -269,6 +350,8 @@ namespace chaos
 		std::optional<size_t> max_unused_node_count;
 		/** number of unused nodes */
 		size_t unused_node_count = 0;
+		/** the nodes indexed by the address of their data */
+		std::unordered_map<uintptr_t, node_type*> node_lookup;
 	};
 
 #endif
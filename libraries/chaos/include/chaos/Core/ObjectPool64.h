@@ -30,10 +30,10 @@ namespace chaos
 		/** destructor */
 		~ObjectPool64()
 		{
-			// destroy all objects
-			BitTools::ForEachBitForward(used_instanced, [this](int64_t index)
+			// destroy all constructed objects (memory that has only been reserved is not touched)
+			BitTools::ForEachBitForward(live_instanced, [this](int64_t index)
 			{
-				Free(GetObjectPtr(index));
+				GetObjectPtr(index)->~type();
 			});
 		}
 
@@ -42,20 +42,28 @@ namespace chaos
 		{
 			if (object != nullptr)
 			{
-				assert(IsObjectInsidePool(object));
-				// update the available flag
-				int64_t index = GetObjectIndex(object);
-				assert((used_instanced >> index) & 1); // ensure the object was not already freed
-				used_instanced = BitTools::SetBit(used_instanced, index, false);
-				--reserved_count;
+				SetObjectLive(object, false);
 				// manually call the destructor
 				object->~type();
+				Release(object);
 			}
 		}
 
 		/** allocate a new object from pool */
 		template<typename ...PARAMS>
 		type* Allocate(PARAMS ...params)
+		{
+			type* result = Reserve();
+			if (result == nullptr)
+				return nullptr;
+			// manually call constructor
+			new (result) type(std::forward<PARAMS>(params)...);
+			SetObjectLive(result, true);
+			return result;
+		}
+
+		/** reserve the memory for an object (no constructor is called) */
+		type* Reserve()
 		{
 			if (!HasAvailableInstanceLeft())
 				return nullptr;
@@ -63,10 +71,20 @@ namespace chaos
 			int64_t index = BitTools::bsr(~used_instanced);
 			used_instanced = BitTools::SetBit(used_instanced, index, true);
 			++reserved_count;
-			// manually call constructor
-			type* result = GetObjectPtr(index);
-			new (result) type(std::forward<PARAMS>(params)...);
-			return result;
+			return GetObjectPtr(index);
+		}
+
+		/** release the memory of an object (no destructor is called) */
+		void Release(type* object)
+		{
+			assert(object != nullptr);
+			assert(IsObjectInsidePool(object));
+			// update the available flag
+			int64_t index = GetObjectIndex(object);
+			assert((used_instanced >> index) & 1); // ensure the object was not already freed
+			assert(((live_instanced >> index) & 1) == 0); // a constructed object must be destroyed with Free(...)
+			used_instanced = BitTools::SetBit(used_instanced, index, false);
+			--reserved_count;
 		}
 
 		/** check whether an object is inside the pool */
@@ -88,26 +106,35 @@ namespace chaos
 			return reserved_count;
 		}
 
-		/** iterator over all objects (const version) */
+		/** iterator over all constructed objects (const version) */
 		template<typename FUNC>
 		decltype(auto) ForEachObject(FUNC const& func) const
 		{
-			return chaos::BitTools::ForEachBitForward(used_instanced, [this, &func](int64_t index)
+			return chaos::BitTools::ForEachBitForward(live_instanced, [this, &func](int64_t index)
 			{
 				return func(GetObjectPtr(index));
 			});
 		}
 
-		/** iterator over all objects (non const version) */
+		/** iterator over all constructed objects (non const version) */
 		template<typename FUNC>
 		decltype(auto) ForEachObject(FUNC const& func)
 		{
-			return chaos::BitTools::ForEachBitForward(used_instanced, [this, &func](int64_t index)
+			return chaos::BitTools::ForEachBitForward(live_instanced, [this, &func](int64_t index)
 			{
 				return func(GetObjectPtr(index));
 			});
 		}
 
+		/** mark an object as constructed or destroyed (the objects reserved and constructed by the caller may be marked so that the pool destroys them) */
+		void SetObjectLive(type const* object, bool live)
+		{
+			assert(IsObjectInsidePool(object));
+			int64_t index = GetObjectIndex(object);
+			assert((used_instanced >> index) & 1);
+			live_instanced = BitTools::SetBit(live_instanced, index, live);
+		}
+
 	protected:
 
 		/** gets the index of an object inside the pool */
@@ -137,6 +164,8 @@ namespace chaos
 
 		/** a bitfield indicating with instances are in use */
 		int64_t used_instanced = 0;
+		/** a bitfield indicating with instances have been constructed (a subset of used_instanced) */
+		int64_t live_instanced = 0;
 		/** number of reserved object */
 		size_t reserved_count = 0;
 		/** the block of data where instanced are being used */
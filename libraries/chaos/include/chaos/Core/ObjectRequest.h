@@ -5,6 +5,7 @@ namespace chaos
 	enum class ObjectRequestType;
 
 	class ObjectRequest;
+	class ObjectRequestIndex;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
@@ -181,6 +182,132 @@ namespace chaos
 		ObjectRequestType request_type = ObjectRequestType::NONE;
 	};
 
+	/**
+	* ObjectRequestIndex : an index over a vector of named objects so that requests are resolved without a linear scan
+	*
+	* The result is the same than ObjectRequest::FindObjectIndex(...) (the first matching element).
+	* Tags are resolved with a direct-indexed table covering the range of tags in the vector when this range is dense (i.e character codes),
+	* otherwise with a hash. Names are resolved with a case-insensitive hash.
+	* The owner of the vector must invalidate the index whenever the vector (or the name/tag of an element) changes, and build it again.
+	* While it is invalidated, or has been built for another vector (size or storage differs), the search falls back to the linear scan.
+	**/
+	class CHAOS_API ObjectRequestIndex
+	{
+	public:
+
+		/** the direct-indexed table is used if the range of tags is not greater than this value */
+		static constexpr size_t min_direct_tag_range = 256;
+		/** the direct-indexed table is used if the range of tags is not greater than this factor by the number of elements */
+		static constexpr size_t direct_tag_density = 4;
+
+		/** build the index for a vector */
+		template<typename P>
+		void Build(std::vector<P> const& elements)
+		{
+			Clear();
+			built = true;
+			element_count = elements.size();
+			element_data = elements.data();
+			if (element_count > 0)
+			{
+				TagType min_tag = std::numeric_limits<TagType>::max();
+				TagType max_tag = 0;
+				for (size_t i = 0; i < element_count; ++i)
+				{
+					TagType tag = meta::get_raw_pointer(elements[i])->GetTag();
+					min_tag = std::min(min_tag, tag);
+					max_tag = std::max(max_tag, tag);
+				}
+				PrepareDirectTags(min_tag, max_tag);
+			}
+			for (size_t i = 0; i < element_count; ++i)
+			{
+				auto e = meta::get_raw_pointer(elements[i]);
+				AddEntry(e->GetName(), e->GetTag(), i);
+			}
+		}
+		/** clear the index */
+		void Clear();
+		/** mark the index as not usable until it is built again (the memory is kept) */
+		void Invalidate() { built = false; }
+		/** returns whether the index can be used for a vector */
+		template<typename P>
+		bool IsUpToDate(std::vector<P> const& elements) const
+		{
+			return built && element_count == elements.size() && element_data == elements.data();
+		}
+
+		/** search element in a vector */
+		template<typename VECTOR>
+		auto FindObject(ObjectRequest const& request, VECTOR& elements) const -> decltype(meta::get_raw_pointer(elements[0]))
+		{
+			std::optional<size_t> index = FindObjectIndex(request, elements);
+			if (index.has_value())
+				return meta::get_raw_pointer(elements[*index]);
+			return nullptr;
+		}
+
+		/** search element in a vector */
+		template<typename P>
+		std::optional<size_t> FindObjectIndex(ObjectRequest const& request, std::vector<P> const& elements) const
+		{
+			// the index does not correspond to the vector
+			if (!IsUpToDate(elements))
+				return request.FindObjectIndex(elements);
+
+			if (request.IsNoneRequest())
+				return {};
+			if (request.IsAnyRequest())
+				return (element_count > 0) ? std::optional<size_t>(0) : std::optional<size_t>();
+			if (request.IsTagRequest())
+				return FindTagIndex(request.tag);
+			if (request.IsStringRequest())
+			{
+				// different names may have the same hash : check candidates and keep the first one
+				std::optional<size_t> result;
+				auto range = names.equal_range(GetNameHash(request.name));
+				for (auto it = range.first; it != range.second; ++it)
+					if (!result.has_value() || it->second < *result)
+						if (request.Match(*meta::get_raw_pointer(elements[it->second])))
+							result = it->second;
+				return result;
+			}
+			return {};
+		}
+
+		/** compute the case-insensitive hash of a name */
+		static size_t GetNameHash(char const* name);
+
+	protected:
+
+		/** allocate the direct-indexed table if the range of tags is dense enough */
+		void PrepareDirectTags(TagType min_tag, TagType max_tag);
+		/** insert an element in the index */
+		void AddEntry(char const* name, TagType tag, size_t index);
+		/** search the first element with a given tag */
+		std::optional<size_t> FindTagIndex(TagType tag) const;
+
+	protected:
+
+		/** whether the index has been built */
+		bool built = false;
+		/** the number of elements in the indexed vector */
+		size_t element_count = 0;
+		/** the storage of the indexed vector (a copied or reallocated vector is not the indexed one) */
+		void const* element_data = nullptr;
+		/** the tag of the first entry of direct_tags */
+		TagType direct_tag_base = 0;
+		/** the first element for each tag in [direct_tag_base, direct_tag_base + direct_tags.size()[ (INVALID_INDEX for none) */
+		std::vector<uint32_t> direct_tags;
+		/** the first element for the other tags */
+		std::unordered_map<TagType, size_t> other_tags;
+		/** the elements by hash of their name */
+		std::unordered_multimap<size_t, size_t> names;
+
+		/** the value of direct_tags entries without element */
+		static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+	};
+
 #endif
 
 }; // namespace chaos
\ No newline at end of file
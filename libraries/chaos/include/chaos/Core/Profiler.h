@@ -0,0 +1,216 @@
+namespace chaos
+{
+#ifdef CHAOS_FORWARD_DECLARATION
+
+	class ProfilerEvent;
+	class ProfilerZoneStatistics;
+	class ProfilerThreadBuffer;
+	class Profiler;
+	class ProfilerZone;
+
+#elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	/** CHAOS_PROFILE_ZONE(name) : measure the duration of the current scope (name must be a string with static storage) */
+#if !defined CHAOS_NO_PROFILER
+#define CHAOS_PROFILE_ZONE(name) chaos::ProfilerZone const BOOST_PP_CAT(profiler_zone_, __LINE__)(name)
+#else
+#define CHAOS_PROFILE_ZONE(name)
+#endif
+
+	/**
+	 * ProfilerEvent: a zone that has been measured
+	 */
+
+	class CHAOS_API ProfilerEvent
+	{
+	public:
+
+		/** the name of the zone */
+		char const* name = nullptr;
+		/** the beginning of the zone (nanoseconds) */
+		int64_t start = 0;
+		/** the end of the zone (nanoseconds) */
+		int64_t end = 0;
+	};
+
+	/**
+	 * ProfilerZoneStatistics: the timings of a zone over the frames
+	 */
+
+	class CHAOS_API ProfilerZoneStatistics
+	{
+	public:
+
+		/** the name of the zone */
+		char const* name = nullptr;
+		/** the number of calls during the last frame */
+		size_t frame_call_count = 0;
+		/** the time spent in the zone during the last frame (milliseconds, all threads included) */
+		double frame_duration = 0.0;
+		/** a smoothed value of frame_duration */
+		double average_frame_duration = 0.0;
+		/** the longest single call (milliseconds) */
+		double max_call_duration = 0.0;
+		/** the number of calls since the statistics have been reset */
+		size_t total_call_count = 0;
+	};
+
+	/**
+	 * ProfilerThreadBuffer: where a thread records its events
+	 *
+	 * The owning thread pushes its events into a lock-free ring (an event is lost if the ring is full).
+	 * The collector drains the ring and keeps the last events in a history (the oldest ones are overwritten) for the traces.
+	 * When its thread exits, the buffer is released and the next new thread reuses it (with the same thread index in the traces).
+	 */
+
+	class CHAOS_API ProfilerThreadBuffer : public Object
+	{
+		friend class Profiler;
+
+	public:
+
+		/** constructor */
+		ProfilerThreadBuffer(size_t in_thread_index, size_t capacity);
+
+		/** add an event (called by the owning thread only, lock-free) */
+		void Push(ProfilerEvent const& event);
+		/** get the index of the thread */
+		size_t GetThreadIndex() const { return thread_index; }
+		/** called when the owning thread exits : another thread may use the buffer */
+		void Release() { in_use.store(false, boost::memory_order_release); }
+
+	protected:
+
+		/** drain the events pushed since the last extraction and keep them in the history (returns the number of events that have been lost) */
+		size_t ExtractNewEvents(std::vector<ProfilerEvent>& result);
+		/** copy all the events still in the history */
+		void GetEvents(std::vector<ProfilerEvent>& result) const;
+		/** remove all events */
+		void Clear();
+
+	protected:
+
+		/** the index of the thread */
+		size_t thread_index = 0;
+		/** the events pushed by the owning thread and not extracted yet */
+		ConcurrentRingBuffer<ProfilerEvent> pending_events;
+		/** the number of events that could not be pushed because the ring was full */
+		boost::atomic<size_t> dropped_count{ 0 };
+		/** whether a thread owns the buffer */
+		boost::atomic<bool> in_use{ true };
+
+		/** the history of the extracted events (the collector is the only user, with the mutex of the profiler locked) */
+		std::vector<ProfilerEvent> events;
+		/** the number of events ever written into the history */
+		uint64_t write_count = 0;
+	};
+
+	/**
+	 * Profiler: a singleton collecting the zones measured by all threads
+	 *
+	 * While the profiler is disabled, a zone costs a single atomic read.
+	 * EndFrame() is to be called once per frame to update the statistics of the zones.
+	 */
+
+	class CHAOS_API Profiler : public Singleton<Profiler>
+	{
+	public:
+
+		/** the number of events kept for each thread */
+		static constexpr size_t default_event_capacity = 32768;
+		/** the weight of the last frame for the average durations */
+		static constexpr double average_factor = 0.05;
+
+		/** constructor */
+		Profiler();
+		/** destructor (the buffers still owned by some threads are destroyed when these threads exit) */
+		~Profiler();
+
+		/** whether the zones are recorded */
+		static bool IsEnabled() { return enabled.load(boost::memory_order_relaxed); }
+		/** enable or disable the recording */
+		void SetEnabled(bool in_enabled);
+
+		/** get the current time (nanoseconds) */
+		static int64_t GetTimestamp();
+
+		/** record a zone for the calling thread */
+		void RecordZone(char const* name, int64_t start, int64_t end);
+		/** mark the end of a frame and update the statistics */
+		void EndFrame();
+
+		/** get the statistics of all zones */
+		std::vector<ProfilerZoneStatistics> GetZoneStatistics() const;
+		/** get the number of events that have been overwritten before being counted in the statistics */
+		size_t GetLostEventCount() const;
+		/** remove all recorded events and statistics */
+		void Clear();
+
+		/** save all the events still in the histories with the Chrome trace event format (chrome://tracing or Perfetto). The events of the current frame are not extracted yet */
+		bool SaveChromeTrace(FilePathParam const& path) const;
+
+	protected:
+
+		/** get (or create) the buffer of the calling thread */
+		ProfilerThreadBuffer* GetThreadBuffer();
+
+	protected:
+
+		/** whether the zones are recorded */
+		static boost::atomic<bool> enabled;
+
+		/** the mutex protecting the buffers list, their histories and the statistics */
+		mutable boost::mutex mutex;
+		/** the buffers of all threads that have recorded something (shared with their threads) */
+		std::vector<shared_ptr<ProfilerThreadBuffer>> thread_buffers;
+		/** the statistics of the zones */
+		std::map<std::string_view, ProfilerZoneStatistics> zone_statistics;
+		/** the number of events lost for the statistics */
+		size_t lost_event_count = 0;
+
+		/** the origin of the times in the traces */
+		int64_t origin_timestamp = 0;
+		/** the beginning of the current frame (0 if unknown) */
+		int64_t frame_start_timestamp = 0;
+		/** a buffer to extract the events (avoid allocations) */
+		std::vector<ProfilerEvent> extracted_events;
+	};
+
+	/**
+	 * ProfilerZone: an object that measures the duration of its life (see CHAOS_PROFILE_ZONE)
+	 */
+
+	class CHAOS_API ProfilerZone
+	{
+	public:
+
+		/** constructor */
+		ProfilerZone(char const* in_name):
+			name(Profiler::IsEnabled()? in_name : nullptr)
+		{
+			if (name != nullptr)
+				start = Profiler::GetTimestamp();
+		}
+		/** no copy constructor */
+		ProfilerZone(ProfilerZone const& src) = delete;
+		/** no copy operator */
+		ProfilerZone& operator = (ProfilerZone const& src) = delete;
+
+		/** destructor */
+		~ProfilerZone()
+		{
+			if (name != nullptr)
+				Profiler::GetInstance()->RecordZone(name, start, Profiler::GetTimestamp());
+		}
+
+	protected:
+
+		/** the name of the zone (nullptr while the profiler is disabled) */
+		char const* name = nullptr;
+		/** the beginning of the zone */
+		int64_t start = 0;
+	};
+
+#endif
+
+}; // namespace chaos
\ No newline at end of file
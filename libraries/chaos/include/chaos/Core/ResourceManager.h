@@ -2,19 +2,100 @@ namespace chaos
 {
 #ifdef CHAOS_FORWARD_DECLARATION
 
+	enum class ResourceLoadingStatus;
+	class ResourceLoadingHandle;
 	class ResourceManager;
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	// ==============================================================
+	// ASYNCHRONOUS LOADING
+	// ==============================================================
+
+	/** the state of an asynchronous loading */
+	enum class CHAOS_API ResourceLoadingStatus : int
+	{
+		PENDING,
+		SUCCEEDED,
+		FAILED
+	};
+
+	/**
+	* ResourceLoadingHandle : an object to follow an asynchronous loading (it is only updated by the owning thread of the manager)
+	*/
+
+	class CHAOS_API ResourceLoadingHandle : public Object
+	{
+	public:
+
+		/** constructor for a pending loading */
+		ResourceLoadingHandle() = default;
+		/** constructor for a loading that is already over */
+		ResourceLoadingHandle(Object* in_resource);
+
+		/** get the status of the loading */
+		ResourceLoadingStatus GetStatus() const { return status; }
+		/** whether the loading is over (succeeded or not) */
+		bool IsReady() const { return (status != ResourceLoadingStatus::PENDING); }
+
+		/** get the loaded resource (nullptr while pending or on failure) */
+		template<typename T = Object>
+		T* GetResource() const
+		{
+			return auto_cast(resource.get());
+		}
+
+		/** called by the loaders whenever the loading is over */
+		void SetResult(Object* in_resource);
+
+	protected:
+
+		/** the status of the loading */
+		ResourceLoadingStatus status = ResourceLoadingStatus::PENDING;
+		/** the loaded resource */
+		shared_ptr<Object> resource;
+	};
+
+	/** a concept for the loaders that can work in background */
+	template<typename T>
+	concept Implement_LoadObjectAsync = requires(T t, boost::filesystem::path const& path, nlohmann::json const* json)
+	{
+		{t.LoadObjectAsync(path)};
+		{t.LoadObjectAsync("", json)};
+		{t.GetManager()};
+	};
+
 	// ==============================================================
 	// MANAGER
 	// ==============================================================
 
+	// XXX : asynchronous loading
+	//
+	//       The loaders that support it (see Implement_LoadObjectAsync) split their work :
+	//         - the file reading and the decoding are done by the JobManager workers
+	//         - the creation of the final objects (GL objects ...) and their insertion in the manager are done
+	//           on the owning thread by ProcessLoadingTasks(...)
+	//
+	//       The objects loaded this way are not available immediately. Use the handles, GetLoadingProgress() or FlushLoadingTasks().
+	//
+	//       A loading is asynchronous either on explicit demand (LoadObjectAsync(...)) or for the directories and configurations loaded
+	//       while the mode is enabled (SetAsynchronousLoading(...)). Enable the mode only around loadings that flush or poll their
+	//       results : other callers expect the objects to be available as soon as the call returns.
+	//
+	//       The finalization functions must own the data prepared by the workers : they are destroyed without being called if the
+	//       manager is destroyed first.
+	//
+	//       Only the textures (GPUTextureLoader) support it for now. Programs and materials need the GL context all along
+	//       and resolve references to other resources. Sounds and Tiled maps are still loaded synchronously.
+
 	class CHAOS_API ResourceManager : public Object
 	{
 
 	public:
 
+		/** destructor */
+		virtual ~ResourceManager();
+
 		/** start the manager */
 		bool StartManager();
 		/** stop the manager */
@@ -26,6 +107,22 @@ namespace chaos
 		/** initialize the manager from a configuration file */
 		virtual bool InitializeFromConfiguration(nlohmann::json const * config);
 
+		/** change whether the loaders that support it work in background */
+		void SetAsynchronousLoading(bool in_asynchronous_loading);
+		/** whether the loaders that support it work in background */
+		bool IsAsynchronousLoading() const;
+
+		/** push a loading task : prepare_func is executed by a worker, the function it returns is executed on the owning thread */
+		void PushLoadingTask(std::function<std::function<void()>()> prepare_func);
+		/** finalize the loadings whose data are ready (owning thread only). Stops once max_duration (in seconds) is elapsed. Returns the number of finalized loadings */
+		size_t ProcessLoadingTasks(std::optional<float> max_duration = {});
+		/** wait for all loadings and finalize them (owning thread only) */
+		void FlushLoadingTasks();
+		/** get the number of loadings that are not finalized yet */
+		size_t GetPendingLoadingCount() const;
+		/** get the progression of the current loadings in [0, 1] (1 whenever nothing is pending) */
+		float GetLoadingProgress() const;
+
 	protected:
 
 		/** internally starts the manager */
@@ -33,6 +130,16 @@ namespace chaos
 		/** internally stops the manager */
 		virtual bool DoStopManager();
 
+		/** whether the loader is to work in background */
+		template<typename LOADER>
+		static bool IsAsynchronousLoader(LOADER const& loader)
+		{
+			if constexpr (Implement_LoadObjectAsync<LOADER>)
+				if (ResourceManager const* manager = loader.GetManager())
+					return manager->IsAsynchronousLoading();
+			return false;
+		}
+
 		/** load all files from a directory */
 		template<typename LOADER>
 		static void LoadObjectsInDirectory(FilePathParam const & path, LOADER const& loader, bool recurse = false)
@@ -41,6 +148,23 @@ namespace chaos
 			{
 				// copy loader to ensure content is reset for all loaded objects
 				LOADER other_loader = loader;
+				// asynchronous loading : the loader cannot tell whether the path is valid, so directories are never given to it
+				if constexpr (Implement_LoadObjectAsync<LOADER>)
+				{
+					if (IsAsynchronousLoader(other_loader))
+					{
+						if (boost::filesystem::is_directory(p))
+						{
+							if (recurse)
+								LoadObjectsInDirectory(p, loader);
+						}
+						else
+						{
+							other_loader.LoadObjectAsync(p);
+						}
+						return false; // don't stop
+					}
+				}
 				if (other_loader.LoadObject(p) == nullptr && recurse) // let loader decides whether it accepts a directory as a valid path
 				{
 					// if it is a directory and loader fails, recurse inside it
@@ -75,22 +199,30 @@ namespace chaos
 					return nullptr;
 				}
 			}
+			// search the name of the object
+			char const* object_name = nullptr;
+
+			std::string resource_name;
 			// 2 - we receive a key and its is valid (starts with '@')
 			if (name != nullptr && name[0] == '@' && name[1] != 0)
-			{
-				// copy loader to ensure content is reset for all loaded objects
-				LOADER other_loader = loader;
-				return other_loader.LoadObject(name + 1, json);
-			}
+				object_name = name + 1;
 			// 3 - try to find a member 'name'
-			std::string resource_name;
-			if (JSONTools::GetAttribute(json, "name", resource_name))
+			else if (JSONTools::GetAttribute(json, "name", resource_name) && !resource_name.empty())
+				object_name = resource_name.c_str();
+			// 4 - anonymous object
+
+			// copy loader to ensure content is reset for all loaded objects
+			LOADER other_loader = loader;
+			// the object will be available later
+			if constexpr (Implement_LoadObjectAsync<LOADER>)
 			{
-				if (!resource_name.empty())
-					return loader.LoadObject(resource_name.c_str(), json);
+				if (IsAsynchronousLoader(other_loader))
+				{
+					other_loader.LoadObjectAsync(object_name, json);
+					return nullptr;
+				}
 			}
-			// 4 - anonymous object
-			return loader.LoadObject(nullptr, json);
+			return other_loader.LoadObject(object_name, json);
 		}
 
 		/** an utility method to initialize a list of objects from a JSON object or array */
@@ -169,6 +301,19 @@ namespace chaos
 
 		/** whether the manager is started */
 		bool manager_started = false;
+
+		/** whether the loaders that support it work in background */
+		bool asynchronous_loading = false;
+		/** the mutex protecting the loading tasks */
+		mutable boost::mutex loading_mutex;
+		/** the loadings whose data are ready, waiting to be finalized on the owning thread */
+		std::deque<std::function<void()>> finalize_tasks;
+		/** the number of loadings pushed since the last time nothing was pending */
+		size_t loading_task_count = 0;
+		/** the number of loadings finalized since the last time nothing was pending */
+		size_t finalized_task_count = 0;
+		/** the JobManager group of the loading jobs (so that FlushLoadingTasks() only executes loading jobs) */
+		uint64_t loading_job_group = 0;
 	};
 
 #endif
@@ -6,10 +6,22 @@ namespace chaos
 
 #elif !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	/**
+	 * SceneNode : a node of a hierarchy of transforms
+	 *
+	 * The local/world matrices are cached. Changing the transform of a node invalidates the world matrices of the whole sub-tree.
+	 * The invalidation stops at nodes that are already invalid (the descendants of an invalid node are always invalid).
+	 * The ancestors of an invalid node are marked so that UpdateWorldTransforms() skips the clean sub-trees.
+	 */
+
 	class CHAOS_API SceneNode : public GPURenderable
 	{
 		static constexpr int INVALID_LOCAL_TO_PARENT = 1;
 		static constexpr int INVALID_PARENT_TO_LOCAL = 2;
+		static constexpr int INVALID_LOCAL_TO_WORLD = 4;
+		static constexpr int INVALID_WORLD_TO_LOCAL = 8;
+		static constexpr int INVALID_WORLD = INVALID_LOCAL_TO_WORLD | INVALID_WORLD_TO_LOCAL;
+		static constexpr int INVALID_DESCENDANT_WORLD = 16;
 
 	public:
 
@@ -22,9 +34,12 @@ namespace chaos
 		glm::mat4 const& GetParentToLocal() const;
 
 		/** get the transformation from root node */
-		glm::mat4 GetWorldToLocal() const;
+		glm::mat4 const& GetWorldToLocal() const;
 		/** get the transformation to root node */
-		glm::mat4 GetLocalToWorld() const;
+		glm::mat4 const& GetLocalToWorld() const;
+
+		/** update the world matrices of the invalid nodes of the sub-tree (the parents are updated first, so that each node only has to combine its parent's matrices) */
+		void UpdateWorldTransforms();
 
 		/** get the position of the node */
 		glm::vec2 const& GetPosition() const { return transform.position; }
@@ -52,6 +67,13 @@ namespace chaos
 
 	protected:
 
+		/** invalidate the local matrices and the world matrices of the sub-tree */
+		void InvalidateTransforms();
+		/** invalidate the world matrices of the sub-tree */
+		void InvalidateWorldTransforms();
+		/** invalidate the world matrices of the sub-tree (without marking the ancestors) */
+		void DoInvalidateWorldTransforms();
+
 		/** override */
 		virtual int DoDisplay(GPURenderer* renderer, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params) override;
 
@@ -64,8 +86,12 @@ namespace chaos
 		mutable glm::mat4 local_to_parent;
 		/** the cached parent to local matrix */
 		mutable glm::mat4 parent_to_local;
+		/** the cached local to world matrix */
+		mutable glm::mat4 local_to_world;
+		/** the cached world to local matrix */
+		mutable glm::mat4 world_to_local;
 		/** the cache state */
-		mutable int cache_state = INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL;
+		mutable int cache_state = INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL | INVALID_WORLD;
 
 		/** the children nodes */
 		std::vector<shared_ptr<SceneNode>> child_nodes;
@@ -8,6 +8,9 @@ namespace chaos
 (TMLevelInstance) \
 (TMLayerInstance) \
 (TMObject) \
+(TMObjectBroadPhase) \
+(TMObjectBroadPhaseNodeData) \
+(TMObjectBroadPhaseProxy) \
 (TMPath) \
 (TMCameraTemplate) \
 (TMPlayerStart) \
@@ -18,9 +21,14 @@ namespace chaos
 (TMCheckpointTrigger) \
 (TMParticlePopulator) \
 (TMTriggerCollisionInfo)\
+(TMTriggerCollisionRecord)\
 (TMSoundTrigger)\
 (TMParticle)\
 (TMParticlePopulator)\
+(TMParticleGrid)\
+(TMParticleGridEntry)\
+(TMTileChunk)\
+(TMTileChunkDecoding)\
 (TileCollisionComputer)
 
 		// forward declaration
@@ -64,8 +72,10 @@ BOOST_PP_SEQ_FOR_EACH(CHAOS_GAMEPLAY_TM_FORWARD_DECL, _, CHAOS_GAMEPLAY_TM_CLASS
 #endif // CHAOS_FORWARD_DECLARATION
 
 #include "chaos/Gameplay/TM/TMParticle.h"
+#include "chaos/Gameplay/TM/TMParticleGrid.h"
 #include "chaos/Gameplay/TM/TMObjectReferenceSolver.h"
 #include "chaos/Gameplay/TM/TMObject.h"
+#include "chaos/Gameplay/TM/TMObjectBroadPhase.h"
 #include "chaos/Gameplay/TM/TMLevel.h"
 #include "chaos/Gameplay/TM/TMLayerInstance.h"
 #include "chaos/Gameplay/TM/TMLevelInstance.h"
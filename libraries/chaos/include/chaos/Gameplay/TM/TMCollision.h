@@ -157,8 +157,7 @@ namespace chaos
 		{
 			assert(this->li_iterator); // end not reached
 			++this->li_iterator;
-			allocation_index = 0;
-			particle_index = 0;
+			ResetLayerIteration();
 			FindElement(false);
 		}
 
@@ -166,8 +165,7 @@ namespace chaos
 		void NextAllocation()
 		{
 			assert(this->li_iterator); // end not reached
-			++allocation_index;
-			particle_index = 0;
+			ignored_allocation_indices.push_back(allocation_index); // the particles of the allocation are spread among cells. Just ignore them for the rest of the layer
 			FindElement(false);
 		}
 
@@ -175,70 +173,150 @@ namespace chaos
 		void NextParticle()
 		{
 			assert(this->li_iterator); // end not reached
-			++particle_index;
-			FindElement(false);
+			FindElement(true);
 		}
 
 	protected:
 
+		/** reset the iteration data for a new layer */
+		void ResetLayerIteration()
+		{
+			grid = nullptr;
+			linear_scan = false;
+			large_entry_index = 0;
+			entry_index = 0;
+			ignored_allocation_indices.clear();
+		}
+
+		/** check whether an entry of the grid collides. Update the cached result */
+		bool CheckGridEntry(size_t grid_entry_index, bool check_first_cell, bool& ignore_first)
+		{
+			TMParticleGridEntry const& entry = grid->GetEntry(grid_entry_index);
+
+			// ignored allocation
+			if (std::find(ignored_allocation_indices.begin(), ignored_allocation_indices.end(), size_t(entry.allocation_index)) != ignored_allocation_indices.end())
+				return false;
+			// a particle covering several cells is only reported in the first cell shared with the request
+			if (check_first_cell && current_cell != glm::max(cell_range.first, entry.min_cell))
+				return false;
+
+			auto* allocation = this->li_iterator->particle_layer->GetAllocation(entry.allocation_index);
+			if (allocation == nullptr)
+				return false;
+
+			// same for both ParticleAccessor<...> and ParticleConstAccessor<...>
+			RawDataBufferAccessorBase<typename boost::mpl::apply<CONSTNESS_OPERATOR, TMParticle>::type> accessor = allocation->GetParticleAccessor(0, 0);
+
+			auto* particle = &accessor[entry.particle_index];
+			if (!Collide(this->collision_box, particle->bounding_box, this->open_geometry))
+				return false;
+
+			if (ignore_first)
+			{
+				ignore_first = false;
+				return false;
+			}
+
+			allocation_index = entry.allocation_index;
+			particle_index = entry.particle_index;
+
+			cached_result.layer_instance = &(*this->li_iterator);
+			cached_result.allocation = allocation;
+			cached_result.particle = particle;
+			cached_result.tile_info = this->level_instance->GetTiledMap()->FindTileInfo(particle->gid);
+			return true;
+		}
+
 		/** find the very first collision from given conditions */
 		void FindElement(bool ignore_first)
 		{
 			while (this->li_iterator)
 			{
-				auto* particle_layer = this->li_iterator->particle_layer.get();
-
-				if (particle_layer != nullptr)
+				// start the iteration on a new layer
+				if (grid == nullptr)
 				{
-					while (allocation_index < particle_layer->GetAllocationCount())
+					grid = this->li_iterator->GetParticleGrid();
+					if (grid != nullptr)
 					{
-						auto* allocation = particle_layer->GetAllocation(allocation_index);
+						cell_range = grid->GetCellRange(this->collision_box);
+						current_cell = cell_range.first;
+						// the request covers more cells than there are particles : test all particles
+						linear_scan = (TMParticleGrid::GetCellCount(cell_range) > grid->GetEntryCount());
+					}
+				}
 
-						if (allocation != nullptr)
+				if (grid != nullptr)
+				{
+					if (linear_scan)
+					{
+						while (entry_index < grid->GetEntryCount())
+						{
+							if (CheckGridEntry(entry_index, false, ignore_first))
+								return;
+							++entry_index;
+						}
+					}
+					else
+					{
+						// the particles too large to be bucketed
+						std::vector<uint32_t> const& large_entries = grid->GetLargeEntries();
+						while (large_entry_index < large_entries.size())
+						{
+							if (CheckGridEntry(large_entries[large_entry_index], false, ignore_first))
+								return;
+							++large_entry_index;
+						}
+						// the cells covered by the request
+						while (current_cell.y <= cell_range.second.y)
 						{
-							while (particle_index < allocation->GetParticleCount())
+							if (std::vector<uint32_t> const* cell_entries = grid->GetCellEntries(current_cell))
 							{
-								// same for both ParticleAccessor<...> and ParticleConstAccessor<...>
-								RawDataBufferAccessorBase<boost::mpl::apply<CONSTNESS_OPERATOR, TMParticle>::type> accessor = allocation->GetParticleAccessor(0, 0);
-
-								auto * particle = &accessor[particle_index];
-
-								if (Collide(this->collision_box, particle->bounding_box, this->open_geometry))
+								while (entry_index < cell_entries->size())
 								{
-									if (!ignore_first)
-									{
-										cached_result.layer_instance = &(*this->li_iterator);
-										cached_result.allocation = allocation;
-										cached_result.particle = particle;
-										cached_result.tile_info = this->level_instance->GetTiledMap()->FindTileInfo(particle->gid);
+									if (CheckGridEntry((*cell_entries)[entry_index], true, ignore_first))
 										return;
-									}
-									ignore_first = false;
+									++entry_index;
 								}
-								// next particle
-								++particle_index;
+							}
+							// next cell
+							entry_index = 0;
+							if (++current_cell.x > cell_range.second.x)
+							{
+								current_cell.x = cell_range.first.x;
+								++current_cell.y;
 							}
 						}
-						// next allocation
-						++allocation_index;
-						particle_index = 0;
 					}
 				}
 				// next layer instance
 				++this->li_iterator;
-				allocation_index = 0;
-				particle_index = 0;
+				ResetLayerIteration();
 			}
 		}
 
 	protected:
 
-		/** allocation index in that layer */
+		/** allocation index of the current result */
 		size_t allocation_index = 0;
-		/** index of the particle in that layer */
+		/** index of the particle of the current result */
 		size_t particle_index = 0;
 		/** the collision data */
 		collision_info cached_result;
+
+		/** the spatial index of the current layer */
+		TMParticleGrid const* grid = nullptr;
+		/** the cells covered by the request */
+		std::pair<glm::ivec2, glm::ivec2> cell_range = { glm::ivec2(0, 0), glm::ivec2(-1, -1) };
+		/** the current cell */
+		glm::ivec2 current_cell = glm::ivec2(0, 0);
+		/** whether all the particles of the layer are tested (request larger than the content of the layer) */
+		bool linear_scan = false;
+		/** index in the large entries */
+		size_t large_entry_index = 0;
+		/** index in the current cell entries (or in all entries for linear scan) */
+		size_t entry_index = 0;
+		/** the allocations whose particles are to be ignored for the current layer (NextAllocation(...) may be called several times) */
+		std::vector<size_t> ignored_allocation_indices;
 	};
 
 	// =====================================
@@ -25,11 +25,11 @@ namespace chaos
 
 	public:
 
-		/** the entry point for the whole computation */
-		box2 Run(LightweightFunction<void(TileCollisionInfo const& collision_info)> func);
+		/** the entry point for the whole computation. func returns whether it reacted to the collision (displaced dst_box) */
+		box2 Run(LightweightFunction<bool(TileCollisionInfo const& collision_info)> func);
 
-		/** compute reaction for a a particle */
-		void ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const&, Edge)> func);
+		/** compute reaction for a a particle. Returns whether dst_box has been displaced */
+		bool ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const&, Edge)> func);
 
 	public:
 
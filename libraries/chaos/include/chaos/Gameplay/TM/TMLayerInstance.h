@@ -2,6 +2,45 @@ namespace chaos
 {
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
+	// =====================================
+	// TMTileChunkDecoding : the tiles of a streamed chunk, decoded by a job
+	// =====================================
+
+	class CHAOS_API TMTileChunkDecoding : public Object
+	{
+	public:
+
+		/** whether the decoding is over (the tiles can be read) */
+		boost::atomic<bool> done{ false };
+		/** the decoded tiles */
+		std::vector<TiledMap::Tile> tiles;
+	};
+
+	// =====================================
+	// TMTileChunk : a square of tiles of a tile layer with its own particle allocations (hidden while outside the camera)
+	// =====================================
+
+	class CHAOS_API TMTileChunk
+	{
+	public:
+
+		/** the coordinate of the chunk (in chunk units) */
+		glm::ivec2 coordinate = glm::ivec2(0, 0);
+		/** the bounding box of the particles of the chunk (layer coordinates) */
+		box2 bounding_box;
+		/** the allocations of the chunk (one for each run of consecutive tiles of the chunk in the layer order) */
+		std::vector<weak_ptr<ParticleAllocationBase>> allocations;
+
+		/** the encoded chunk of a streamed layer */
+		TiledMap::TileLayerChunk const* streamed_chunk = nullptr;
+		/** the decoding in progress (streamed layer) */
+		shared_ptr<TMTileChunkDecoding> decoding;
+		/** whether the particles of the chunk exist (streamed layer) */
+		bool populated = false;
+		/** the last streaming update for which the chunk was near the camera (streamed layer) */
+		uint64_t last_use = 0;
+	};
+
 	// =====================================
 	// TMLayerInstance : instance of a Layer
 	// =====================================
@@ -14,6 +53,8 @@ namespace chaos
 
 	public:
 
+		/** destructor (remove the objects from the broad phase of the level) */
+		virtual ~TMLayerInstance();
 
 		/** get the tiled layer */
 		TiledMap::LayerBase const* GetTiledLayer() const { return layer; }
@@ -139,6 +180,18 @@ namespace chaos
 		/** get the particle layer */
 		ParticleLayerBase const* GetParticleLayer() const { return particle_layer.get(); }
 
+		/** get the spatial index of the particles (updated if necessary). nullptr if there is no particle layer */
+		TMParticleGrid const* GetParticleGrid() const;
+		/** notify the spatial index that some particles have been moved */
+		void SetParticleGridDirty() { particle_grid.SetDirty(); }
+
+		/** get the number of tile chunks of the layer (0 if the tiles are not partitioned) */
+		size_t GetTileChunkCount() const { return tile_chunks.size(); }
+		/** get the number of tile chunks that have been displayed during the last rendering */
+		size_t GetVisibleTileChunkCount() const { return visible_tile_chunk_count; }
+		/** get the number of tile chunks that are decoded or populated (all of them for a layer that is not streamed) */
+		size_t GetLoadedTileChunkCount() const { return (streamed_tile_layer) ? loaded_tile_chunk_count : tile_chunks.size(); }
+
 		/** returns the number of objects */
 		size_t GetObjectCount() const;
 		/** returns an object by its index */
@@ -194,8 +247,22 @@ namespace chaos
 		/** specialized layer */
 		bool InitializeTileLayer(TiledMap::TileLayer const * tile_layer, TMObjectReferenceSolver& reference_solver);
 		/** specialized layer */
+		bool InitializeStreamedTileLayer(TiledMap::TileLayer const* tile_layer, TMObjectReferenceSolver& reference_solver);
+		/** whether some tile of the tilesets of the map creates an object */
+		bool HasTileObjectFactory();
+		/** specialized layer */
 		bool InitializeGroupLayer(TiledMap::GroupLayer const* group_layer, TMObjectReferenceSolver& reference_solver);
 
+		/** create the object or the particle for a tile (returns false whether the creation of the particle failed). No object is created without reference_solver */
+		bool CreateTileContent(TiledMap::TileLayer const* tile_layer, glm::ivec2 const& tile_coord, TiledMap::Tile const& tile, TMParticlePopulator& particle_populator, TMObjectReferenceSolver* reference_solver, bool create_particle);
+
+		/** decode and populate the chunks near the camera, evict the others when over budget */
+		void UpdateStreamedTileChunks();
+		/** create the particles of a streamed chunk whose decoding is over (its objects exist since the initialization) */
+		void PopulateStreamedTileChunk(TiledMap::TileLayer const* tile_layer, TMTileChunk& tile_chunk);
+		/** remove the particles of the least recently used chunks that are not near the camera */
+		void EvictStreamedTileChunks(size_t count);
+
 		/** create an object in an object layer */
 		TMObjectFactory GetObjectFactory(TiledMap::TypedObject const * in_typed_object);
 
@@ -216,6 +283,10 @@ namespace chaos
 
 		/** compute the collision mask from the formated string */
 		void ComputeLayerCollisionMask(char const* mask);
+		/** get the camera box for this layer (see displacement_ratio) */
+		obox2 GetLayerCameraOBox() const;
+		/** show the tile chunks that intersect the camera for any of the instances of the layer, hide the others */
+		void UpdateTileChunkVisibility(box2 const& camera_box, glm::ivec2 const& start_instance, glm::ivec2 const& last_instance, RepeatedBoxScissor const& scissor);
 
 	protected:
 
@@ -244,10 +315,40 @@ namespace chaos
 		shared_ptr<ParticleLayerBase> particle_layer;
 		/** the objects */
 		std::vector<shared_ptr<TMObject>> objects;
+		/** the spatial index for the particles (mutable because it is lazily updated on collision requests) */
+		mutable TMParticleGrid particle_grid;
 
 		/** the bounding box of the layer (only its own content, not sub layers) */
 		box2 content_bounding_box;
 
+		/** the size of the tile chunks (in tiles, 0 to have the whole tile layer in a single allocation) */
+		int tile_chunk_size = 16;
+		/** the tile chunks */
+		std::vector<TMTileChunk> tile_chunks;
+		/** the number of tile chunks displayed during the last rendering */
+		size_t visible_tile_chunk_count = 0;
+		/** whether the visibility of the tile chunks is to be computed again whatever the camera (the chunks have changed) */
+		bool tile_chunk_visibility_dirty = true;
+		/** the camera box used for the last visibility computation */
+		box2 visibility_camera_box;
+		/** the layer offset used for the last visibility computation */
+		glm::vec2 visibility_offset = glm::vec2(0.0f, 0.0f);
+		/** the first instance used for the last visibility computation */
+		glm::ivec2 visibility_start_instance = glm::ivec2(0, 0);
+		/** the last instance used for the last visibility computation */
+		glm::ivec2 visibility_last_instance = glm::ivec2(0, 0);
+
+		/** whether the tile chunks are decoded and populated when the camera is near (see TiledMap::TileLayer::IsStreamed()) */
+		bool streamed_tile_layer = false;
+		/** the distance around the camera where the chunks are to be loaded */
+		float streaming_distance = 512.0f;
+		/** the number of loaded chunks above which the chunks far from the camera are evicted */
+		int streaming_chunk_budget = 64;
+		/** the number of loaded chunks */
+		size_t loaded_tile_chunk_count = 0;
+		/** the number of streaming updates */
+		uint64_t streaming_update_count = 0;
+
 		/** the collision mask for that layer */
 		uint64_t collision_mask = 0;
 
@@ -3,22 +3,31 @@ namespace chaos
 #if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
 
 	// =====================================
-	// TMTriggerCollisionInfo
+	// TMTriggerCollisionRecord : a trigger colliding with an object
 	// =====================================
 
-	class CHAOS_API TMTriggerCollisionInfo
+	class CHAOS_API TMTriggerCollisionRecord
 	{
 	public:
 
-		/** search whether a trigger is in the collision list */
-		bool FindTrigger(TMTrigger const * trigger) const;
+		/** the trigger (detect destruction) */
+		weak_ptr<TMTrigger> trigger;
+		/** the stamp of the last HandleTriggerCollisions(...) call where the trigger was colliding */
+		uint64_t collision_stamp = 0;
+	};
 
+	// =====================================
+	// TMTriggerCollisionInfo
+	// =====================================
+
+	class CHAOS_API TMTriggerCollisionInfo
+	{
 	public:
 
 		/** the target considered */
 		weak_ptr<Object> object;
 		/** all the triggers colliding */
-		std::vector<weak_ptr<TMTrigger>> triggers;
+		std::unordered_map<TMTrigger const*, TMTriggerCollisionRecord> triggers;
 	};
 
 	// =====================================
@@ -119,6 +128,13 @@ namespace chaos
 		/** handle all collision for a given object (TriggerObject) */
 		void HandleTriggerCollisions(float delta_time, Object* object, box2 const& box, int mask);
 
+		/** get the broad phase for objects */
+		TMObjectBroadPhase& GetObjectBroadPhase() { return object_broad_phase; }
+		/** get the broad phase for objects */
+		TMObjectBroadPhase const& GetObjectBroadPhase() const { return object_broad_phase; }
+		/** insert all the objects of all layers into the broad phase (clear previous content) */
+		void RebuildObjectBroadPhase();
+
 
 		/** override */
 		virtual bool SerializeFromJSON(JSONReadConfiguration config) override;
@@ -189,6 +205,9 @@ namespace chaos
 
 	protected:
 
+		/** the spatial index for all objects of all layers (declared before the layers, so that it is destroyed after them) */
+		TMObjectBroadPhase object_broad_phase;
+
 		/** the player start */
 		weak_ptr<TMPlayerStart> player_start;
 		/** the main camera */
@@ -204,8 +223,10 @@ namespace chaos
 
 		/** the layers */
 		std::vector<shared_ptr<TMLayerInstance>> layer_instances;
-		/** the previous frame trigger collision */
-		std::vector<TMTriggerCollisionInfo> collision_info;
+		/** the previous frame trigger collision (for each object) */
+		std::unordered_map<Object const*, TMTriggerCollisionInfo> collision_info;
+		/** a counter incremented for each HandleTriggerCollisions(...) call */
+		uint64_t trigger_collision_stamp = 0;
 	};
 
 #endif
@@ -0,0 +1,199 @@
+namespace chaos
+{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// =====================================
+	// TMObjectBroadPhaseNodeData : the data stored in each node of the tree
+	// =====================================
+
+	class CHAOS_API TMObjectBroadPhaseNodeData
+	{
+	public:
+
+		/** the node is useful as long as it contains some objects */
+		bool IsUseful() const
+		{
+			return (proxies.size() > 0);
+		}
+
+	public:
+
+		/** the proxies inside the node */
+		std::vector<size_t> proxies;
+	};
+
+	// =====================================
+	// TMObjectBroadPhaseProxy : the representation of an object inside the broad phase
+	// =====================================
+
+	class CHAOS_API TMObjectBroadPhaseProxy
+	{
+	public:
+
+		/** the object (may have been destroyed) */
+		weak_ptr<TMObject> object;
+		/** the raw pointer on the object (used as a key, even if the object has been destroyed) */
+		TMObject const* object_key = nullptr;
+		/** the world bounding box of the object the last time it was updated */
+		box2 bounding_box;
+		/** the node containing the proxy (nullptr for empty bounding box) */
+		Tree27Node<2, TMObjectBroadPhaseNodeData>* node = nullptr;
+		/** an increasing number used to keep results in insertion order */
+		uint64_t insertion_order = 0;
+	};
+
+	// =====================================
+	// TMObjectBroadPhase : a Tree27 indexing the bounding boxes of TMObject
+	// =====================================
+
+	class CHAOS_API TMObjectBroadPhase
+	{
+	public:
+
+		/** the type of the tree */
+		using tree_type = Tree27<2, TMObjectBroadPhaseNodeData>;
+		/** the type of the nodes */
+		using node_type = tree_type::node_type;
+
+		/** the minimum size of an object considered for node computation (avoid points to be sent in deep levels) */
+		static constexpr float MIN_OBJECT_SIZE = 1.0f;
+
+		/** insert an object in the broad phase */
+		bool InsertObject(TMObject* object);
+		/** remove an object from the broad phase */
+		bool RemoveObject(TMObject const* object);
+		/** update the position of an object (it only changes of node if necessary) */
+		bool UpdateObject(TMObject const* object);
+		/** update all objects (and remove the ones that have been destroyed) */
+		void UpdateAllObjects();
+		/** remove all objects */
+		void Clear();
+
+		/** get the number of objects */
+		size_t GetObjectCount() const { return proxies.size(); }
+		/** get the tree */
+		tree_type const& GetTree() const { return tree; }
+
+		/** call a function for each object colliding with the box (FUNC returns true to stop the iteration). Returns whether the iteration has been stopped */
+		template<typename FUNC>
+		bool ForEachObject(box2 const& box, uint64_t collision_mask, bool open_geometry, FUNC const& func)
+		{
+			return DoForEachObject(box, collision_mask, [&box, open_geometry](box2 const& object_box)
+			{
+				return Collide(box, object_box, open_geometry);
+			}, func);
+		}
+
+		/** call a function for each object colliding with the sphere (FUNC returns true to stop the iteration). Returns whether the iteration has been stopped */
+		template<typename FUNC>
+		bool ForEachObject(sphere2 const& sphere, uint64_t collision_mask, bool open_geometry, FUNC const& func)
+		{
+			return DoForEachObject(GetBoundingBox(sphere), collision_mask, [&sphere, open_geometry](box2 const& object_box)
+			{
+				return Collide(sphere, object_box, open_geometry);
+			}, func);
+		}
+
+		/** call a function for each pair of colliding objects (FUNC returns true to stop the iteration). Returns whether the iteration has been stopped */
+		template<typename FUNC>
+		bool ForEachOverlappingPair(uint64_t collision_mask, bool open_geometry, FUNC const& func)
+		{
+			size_t count = proxies.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				TMObject* object1 = GetProxyObject(i, collision_mask);
+				if (object1 == nullptr || proxies[i].node == nullptr)
+					continue;
+
+				box2 const& box1 = proxies[i].bounding_box;
+
+				bool stopped = false;
+				tree.ForEachIntersectingNode(box1, [this, i, object1, &box1, collision_mask, open_geometry, &func, &stopped](node_type * node)
+				{
+					if (stopped)
+						return;
+					for (size_t j : node->proxies)
+					{
+						if (j <= i) // each pair is only reported once
+							continue;
+						TMObject* object2 = GetProxyObject(j, collision_mask);
+						if (object2 == nullptr)
+							continue;
+						if (!Collide(box1, proxies[j].bounding_box, open_geometry))
+							continue;
+						if (func(object1, object2))
+						{
+							stopped = true;
+							return;
+						}
+					}
+				});
+				if (stopped)
+					return true;
+			}
+			return false;
+		}
+
+		/** get all objects colliding with a box (sorted by insertion order) */
+		void CollectObjects(box2 const& box, uint64_t collision_mask, bool open_geometry, std::vector<TMObject*>& result);
+
+	protected:
+
+		/** the generic method for queries */
+		template<typename COLLIDE_FUNC, typename FUNC>
+		bool DoForEachObject(box2 const& search_box, uint64_t collision_mask, COLLIDE_FUNC const& collide_func, FUNC const& func)
+		{
+			bool stopped = false;
+			tree.ForEachIntersectingNode(search_box, [this, collision_mask, &collide_func, &func, &stopped](node_type* node)
+			{
+				if (stopped)
+					return;
+				for (size_t index : node->proxies)
+				{
+					TMObject* object = GetProxyObject(index, collision_mask);
+					if (object == nullptr)
+						continue;
+					if (!collide_func(proxies[index].bounding_box))
+						continue;
+					if (func(object))
+					{
+						stopped = true;
+						return;
+					}
+				}
+			});
+			return stopped;
+		}
+
+		/** get the object of a proxy if it still exists and matches the mask */
+		TMObject* GetProxyObject(size_t index, uint64_t collision_mask) const;
+
+		/** find the index of the proxy for an object */
+		size_t FindProxyIndex(TMObject const* object) const;
+		/** insert a proxy in the tree */
+		void InsertProxyInTree(size_t index);
+		/** remove a proxy from the tree */
+		void RemoveProxyFromTree(size_t index);
+		/** remove a proxy */
+		void RemoveProxy(size_t index);
+		/** update a proxy with its object current bounding box */
+		void UpdateProxy(size_t index, box2 const& bounding_box);
+
+		/** get the box used to compute the node of an object */
+		static box2 GetNodeComputationBox(box2 const& bounding_box);
+
+	protected:
+
+		/** the tree */
+		tree_type tree;
+		/** the proxies */
+		std::vector<TMObjectBroadPhaseProxy> proxies;
+		/** the index of the proxy for each object */
+		std::unordered_map<TMObject const*, size_t> proxy_indices;
+		/** the insertion counter */
+		uint64_t insertion_counter = 0;
+	};
+
+#endif
+
+}; // namespace chaos
@@ -0,0 +1,129 @@
+namespace chaos
+{
+#if !defined CHAOS_FORWARD_DECLARATION && !defined CHAOS_TEMPLATE_IMPLEMENTATION
+
+	// =====================================
+	// TMParticleGridEntry : a particle referenced by the grid
+	// =====================================
+
+	class CHAOS_API TMParticleGridEntry
+	{
+	public:
+
+		/** the index of the allocation in the particle layer */
+		uint32_t allocation_index = 0;
+		/** the index of the particle in the allocation */
+		uint32_t particle_index = 0;
+		/** the bounding box of the particle when it has been inserted in the grid */
+		box2 bounding_box;
+		/** the first cell covered by the particle */
+		glm::ivec2 min_cell = glm::ivec2(0, 0);
+		/** the last cell covered by the particle (included) */
+		glm::ivec2 max_cell = glm::ivec2(0, 0);
+		/** whether the particle is too large to be inserted into cells */
+		bool large_entry = false;
+	};
+
+	// =====================================
+	// TMParticleGrid : a spatial index for the particles of a layer
+	// =====================================
+
+	//
+	// The particles are bucketed into square cells (the size of a tile of the map).
+	// Only non empty cells are stored (hash map), so that infinite or sparse layers do not cost memory.
+	//
+	// A particle covering several cells is referenced in each of them. While querying a box, we only report
+	// a particle in the first cell of the intersection of its own cell range with the query cell range.
+	// That way, there is no duplicate without any additionnal memory.
+	//
+	// Particles covering too much cells (backgrounds, texts ...) are stored in a separate list that is always tested.
+	//
+	// The grid does not know when particles are moving. It must be notified with SetDirty(...)
+	//   -if the allocations or the number of particles changed, the grid is fully rebuilt
+	//   -elsewhere, only the particles whose bounding box changed are relocated
+	//
+
+	class CHAOS_API TMParticleGrid
+	{
+	public:
+
+		/** the maximum number of cells a particle may cover before being considered as a large entry */
+		static constexpr int MAX_CELLS_PER_ENTRY = 64;
+
+		/** set the size of the cells (this clears the grid) */
+		void SetCellSize(glm::vec2 const& in_cell_size);
+		/** get the size of the cells */
+		glm::vec2 const& GetCellSize() const { return cell_size; }
+
+		/** remove all entries */
+		void Clear();
+
+		/** require an update of the grid */
+		void SetDirty() { dirty = true; }
+		/** returns whether the grid requires an update */
+		bool IsDirty() const { return dirty; }
+
+		/** update the grid with the content of a particle layer (if required) */
+		void Update(ParticleLayerBase const* particle_layer);
+
+		/** get the range of cells touched by a box (both included) */
+		std::pair<glm::ivec2, glm::ivec2> GetCellRange(box2 const& box) const;
+		/** get the number of cells in a range */
+		static size_t GetCellCount(std::pair<glm::ivec2, glm::ivec2> const& cell_range);
+		/** get the cells touched by a box moving of 'delta', in the order they are reached (returns false whether there are more than max_count cells) */
+		bool GetSweptCells(box2 const& box, glm::vec2 const& delta, std::vector<glm::ivec2>& result, size_t max_count) const;
+
+		/** get the entries of a cell (nullptr if the cell is empty) */
+		std::vector<uint32_t> const* GetCellEntries(glm::ivec2 const& cell) const;
+		/** get the entries that are too large to be bucketed */
+		std::vector<uint32_t> const& GetLargeEntries() const { return large_entries; }
+
+		/** get the number of entries */
+		size_t GetEntryCount() const { return entries.size(); }
+		/** get an entry by its index */
+		TMParticleGridEntry const& GetEntry(size_t index) const { return entries[index]; }
+		/** get the number of non empty cells */
+		size_t GetNonEmptyCellCount() const { return cells.size(); }
+
+	protected:
+
+		/** returns whether the allocations or their particle count changed since last build (constant time, see ParticleLayerBase::GetStructureGeneration()) */
+		bool HasStructureChanged(ParticleLayerBase const* particle_layer) const;
+		/** fully rebuild the grid */
+		void Rebuild(ParticleLayerBase const* particle_layer);
+		/** relocate the particles that have moved since last update */
+		void RelocateMovedParticles(ParticleLayerBase const* particle_layer);
+
+		/** compute the cells of an entry from its bounding box */
+		void ComputeEntryCells(TMParticleGridEntry& entry) const;
+		/** insert the entry in all the cells it covers */
+		void InsertEntry(uint32_t entry_index);
+		/** remove the entry from all the cells it covers */
+		void RemoveEntry(uint32_t entry_index);
+
+		/** compute the hash key of a cell */
+		static uint64_t GetCellKey(glm::ivec2 const& cell);
+
+	protected:
+
+		/** the size of a cell */
+		glm::vec2 cell_size = glm::vec2(32.0f, 32.0f);
+		/** whether the grid requires an update */
+		bool dirty = true;
+
+		/** all the particles referenced by the grid (ordered by allocations then particles) */
+		std::vector<TMParticleGridEntry> entries;
+		/** the non empty cells */
+		std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+		/** the entries too large to be bucketed */
+		std::vector<uint32_t> large_entries;
+
+		/** the layer used for last build */
+		ParticleLayerBase const* built_layer = nullptr;
+		/** the structure generation of the layer for last build */
+		uint64_t built_generation = 0;
+	};
+
+#endif
+
+}; // namespace chaos
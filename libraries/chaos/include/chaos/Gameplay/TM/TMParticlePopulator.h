@@ -24,9 +24,13 @@ namespace chaos
 		bool AddParticle(char const* bitmap_name, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio);
 		/** flush remaining particles */
 		bool FlushParticles();
+		/** flush remaining particles and use a new allocation for the next ones */
+		bool StartNewAllocation();
 
 		/** get the final bounding box */
 		box2 const& GetBoundingBox() const { return bounding_box; }
+		/** get the bounding box of the particles of the current allocation */
+		box2 const& GetAllocationBoundingBox() const { return allocation_bounding_box; }
 		/** get the particle allocation */
 		ParticleAllocationBase* GetParticleAllocation() { return allocation; }
 
@@ -59,6 +63,8 @@ namespace chaos
 		size_t particle_count = 0;
 		/** a bounding box */
 		box2 bounding_box;
+		/** the bounding box of the current allocation */
+		box2 allocation_bounding_box;
 	};
 
 #endif
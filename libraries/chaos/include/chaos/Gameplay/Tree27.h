@@ -207,7 +207,7 @@ namespace chaos
 
 			int result = 0;
 			int multiplier = 1;
-			for (int i = 0; i < dimension; ++i, multiplier *= dimension)
+			for (int i = 0; i < dimension; ++i, multiplier *= 3)
 			{
 				if (info.position[i] >= central_child_range.first[i])
 				{
@@ -608,6 +608,22 @@ namespace chaos
 				return typename L::result_type{};
 		}
 
+		/** visit the nodes whose bounding box collides with a given box (children of a non colliding node are skipped) */
+		template<typename FUNC>
+		void ForEachIntersectingNode(box_type const& box, FUNC const& func)
+		{
+			if (auto* root_node = GetRootNode())
+				ForEachIntersectingNodeHelper(root_node, box, func);
+		}
+
+		/** visit the nodes whose bounding box collides with a given box (children of a non colliding node are skipped) */
+		template<typename FUNC>
+		void ForEachIntersectingNode(box_type const& box, FUNC const& func) const
+		{
+			if (auto* root_node = GetRootNode())
+				ForEachIntersectingNodeHelper(root_node, box, func);
+		}
+
 		/** returns the root */
 		node_type* GetRootNode()
 		{
@@ -680,6 +696,20 @@ namespace chaos
 			return nullptr;
 		}
 
+		/** utility method to recursively visit intersecting nodes for both CONST and NON-CONST version */
+		template<typename NODE, typename FUNC>
+		static void ForEachIntersectingNodeHelper(NODE* node, box_type const& box, FUNC const& func)
+		{
+			// the descendants are fully contained by their ancestors : no need to go further
+			if (!Collide(node->GetBoundingBox(), box))
+				return;
+			func(node);
+			BitTools::ForEachBitForward(node->existing_children, [node, &box, &func](int index)
+			{
+				ForEachIntersectingNodeHelper(node->GetChild(index), box, func);
+			});
+		}
+
 		/** create a node and insert it into its parent or set it as root */
 		node_type* DoAddNodeToParent(node_info_type const& node_info, node_type* parent_node, int index_in_parent)
 		{
@@ -53,6 +53,9 @@ namespace chaos
 			return ProcessAction(name, GPUProgramGetValueAction<T>(result));
 		}
 
+		/** the only name this provider may handle (nullptr if it can handle any name) */
+		virtual char const* GetHandledName() const { return nullptr; }
+
 	protected:
 
 		/** the main method : returns true whether that action has been successfully handled */
@@ -81,6 +84,9 @@ namespace chaos
 		GPUProgramProviderVariableBase(char const* in_name, T const& in_value, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) :
 			handled_name(in_name), value(in_value), pass_type(in_pass_type) {}
 
+		/** override */
+		virtual char const* GetHandledName() const override { return handled_name.c_str(); }
+
 	protected:
 
 		/** the main method */
@@ -115,6 +121,9 @@ namespace chaos
 		GPUProgramProviderTexture(char const* in_name, shared_ptr<GPUTexture> in_value, GPUProgramProviderPassType in_pass_type = GPUProgramProviderPassType::EXPLICIT) :
 			handled_name(in_name), value(in_value), pass_type(in_pass_type) {}
 
+		/** override */
+		virtual char const* GetHandledName() const override { return handled_name.c_str(); }
+
 	protected:
 
 		/** the main method */
@@ -162,6 +171,13 @@ namespace chaos
 
 	/**
 	* GPUProgramProvider : used to fill GPUProgram binding for multiple uniforms / uniforms
+	*
+	* Once there are enough children, a binding plan is built on the first search (and rebuilt whenever the children change).
+	* It sorts the children by the hash of the name they handle, so that a search only consults the children that may handle
+	* the searched name (plus the ones that may handle any name), in the same order than a linear scan would do.
+	* The plan costs a sort of the children : a chain built on the stack for a single draw pays it back within its first uniforms.
+	*
+	* XXX : the plan is updated by the (const) searches. Providers are not thread safe and must only be used by the rendering thread
 	*/
 
 	class CHAOS_API GPUProgramProvider : public GPUProgramProviderBase
@@ -193,17 +209,33 @@ namespace chaos
 		/** remove all uniforms for binding */
 		virtual void Clear();
 
+		/** get the number of children that have not been consulted thanks to the binding plans (since last call) */
+		static size_t ExtractSkippedChildrenCount();
+
+		/** the minimum number of children for a binding plan to be used */
+		static constexpr size_t min_binding_plan_children = 4;
+
 	protected:
 
 		/** the main method */
 		virtual bool DoProcessAction(GPUProgramProviderExecutionData const& execution_data) const override;
 
+		/** build the binding plan if necessary */
+		void UpdateBindingPlan() const;
+
 	protected:
 
 		/** the uniforms to be set */
 		std::vector<shared_ptr<GPUProgramProviderBase>> children_providers;
 		/** some in place code */
 		GPUProgramProviderFunc process_func;
+
+		/** the hash of the handled name and the index of the children, sorted by hash then by decreasing index */
+		mutable std::vector<std::pair<size_t, size_t>> named_children;
+		/** the indices of the children that may handle any name (in reverse order) */
+		mutable std::vector<size_t> unnamed_children;
+		/** whether the binding plan is to be rebuilt */
+		mutable bool binding_plan_dirty = true;
 	};
 
 
@@ -63,6 +63,8 @@ namespace chaos
 		int GetAverageDrawCalls() const;
 		/** get the number of average rendered vertices */
 		int GetAverageVertices() const;
+		/** get the average number of provider lookups avoided by the uniform binding plans */
+		int GetAverageSkippedProviderLookups() const;
 
 		/** get the rendering timestamp */
 		uint64_t GetTimestamp() const;
@@ -91,6 +93,8 @@ namespace chaos
 		TimedAccumulator<int> drawcall_counter;
 		/** for counting drawcall per seconds */
 		TimedAccumulator<int> vertices_counter;
+		/** for counting provider lookups avoided by the uniform binding plans per seconds */
+		TimedAccumulator<int> skipped_provider_lookups_counter;
 
 		/** the owning window */
 		weak_ptr<Window> window;
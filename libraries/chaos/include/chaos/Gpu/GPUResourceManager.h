@@ -67,6 +67,8 @@ namespace chaos
 
 		/** load a texture */
 		GPUTexture* LoadTexture(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& texture_parameters = {});
+		/** load a texture in background (the texture is created by ProcessLoadingTasks(...)) */
+		shared_ptr<ResourceLoadingHandle> LoadTextureAsync(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& texture_parameters = {});
 		/** load a program */
 		GPUProgram* LoadProgram(FilePathParam const& path, char const* name = nullptr);
 		/** load a material */
@@ -23,6 +23,11 @@ namespace chaos
 		/** texture loading from path */
 		virtual GPUTexture* LoadObject(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& parameters = {}) const;
 
+		/** load an object from JSON (the image is decoded in background) */
+		shared_ptr<ResourceLoadingHandle> LoadObjectAsync(char const* name, nlohmann::json const* json, GenTextureParameters const& parameters = {}) const;
+		/** texture loading from path (the image is decoded in background) */
+		shared_ptr<ResourceLoadingHandle> LoadObjectAsync(FilePathParam const& path, char const* name = nullptr, GenTextureParameters const& parameters = {}) const;
+
 		/** Generate a texture from a json content */
 		virtual GPUTexture* GenTextureObject(nlohmann::json const * json, GenTextureParameters const& parameters = {}) const;
 		/** Generate a 1D/2D/rectangle texture from an file */
@@ -57,6 +62,9 @@ namespace chaos
 
 	protected:
 
+		/** decode the image on a worker and create the texture later (name and path must have been checked) */
+		shared_ptr<ResourceLoadingHandle> DoLoadObjectAsync(GenTextureParameters const& parameters) const;
+
 		/** for cubemap texture, returns a layer index depending on the face considered */
 		static int GetCubeMapLayerValueFromSkyBoxFace(SkyBoxImageType face, int level = 0);
 
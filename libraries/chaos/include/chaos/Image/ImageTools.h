@@ -93,12 +93,12 @@ namespace chaos
 		static FREE_IMAGE_FORMAT GetFreeImageFormat(PixelFormat const& pixel_format);
 
 		/** load an image from a buffer */
-		static FIBITMAP* LoadImageFromBuffer(Buffer<char> buffer);
+		static FIBITMAP* LoadImageFromBuffer(Buffer<char const> buffer);
 		/** load an image from file (use our own implementation instead of FreeImage_LoadFromFile to provide our own error management) */
 		static FIBITMAP* LoadImageFromFile(FilePathParam const& path);
 
 		/** load multiple image from a buffer (animated gif) */
-		static std::vector<FIBITMAP*> LoadMultipleImagesFromBuffer(Buffer<char> buffer, ImageAnimationDescription* anim_description = nullptr);
+		static std::vector<FIBITMAP*> LoadMultipleImagesFromBuffer(Buffer<char const> buffer, ImageAnimationDescription* anim_description = nullptr);
 		/** load multiple image from a file (animated gif) */
 		static std::vector<FIBITMAP*> LoadMultipleImagesFromFile(FilePathParam const& path, ImageAnimationDescription* anim_description = nullptr);
 		/** extract from a multi bitmap all pages (this is a 'duplication' due to library limitation) */
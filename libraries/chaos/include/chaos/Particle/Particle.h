@@ -56,6 +56,9 @@
 //
 // Example : we can compute a transform for the whole allocation (single call) and apply it to each particle
 //
+// XXX : with a parallel tick, an allocation may be split into several ranges updated on different threads. All ranges share the
+//       same TYPE_XXX by reference, so UpdateParticle(...) must only read it (the same is true for the AllocationTrait)
+//
 //
 //
 // 3 - if we may have a nested class AllocationTrait, so that the allocation has an instance of that (just for 1.1 cases)
@@ -137,6 +137,8 @@ namespace chaos
 		void OnRemovedFromLayer();
 		/** require the layer to update the GPU buffer */
 		void ConditionalRequireGPUUpdate(bool skip_if_invisible, bool skip_if_empty);
+		/** notify the layer that the number of particles changed */
+		void OnParticleCountChanged();
 
 	protected:
 
@@ -216,6 +218,7 @@ namespace chaos
 			particles.resize(new_count);
 			// notify the layer
 			ConditionalRequireGPUUpdate(true, false);
+			OnParticleCountChanged();
             // get the accessor on the new particles if any
             if (new_count < old_count)
                 return AutoCastedParticleAccessor(this, 0, 0);
@@ -279,17 +282,43 @@ namespace chaos
 			}
         }
 
+		/** write the particles [start, start + count) into consecutive quads, one per particle. May be called from any thread */
+		void ParticlesToQuads(QuadPrimitive<vertex_type> quads, size_t start, size_t count) const
+		{
+			static_assert(ParticleTraitTools::CanGenerateQuadsInParallel<layer_trait_type>());
+			assert(quads.GetVerticesCount() >= 4 * count);
+
+			ParticleConstAccessor<particle_type> particle_accessor = GetParticleAccessor(start, count);
+			for (particle_type const& particle : particle_accessor)
+			{
+				QuadPrimitive<vertex_type> quad(quads.GetBuffer(), quads.GetVertexSize(), 4);
+				ParticleToPrimitive(particle, quad);
+				++quads;
+			}
+		}
+
     protected:
 
 		bool TickAllocation(float delta_time, layer_trait_type const * layer_trait)
 		{
             bool destroy_allocation = false;
 			if (particles.size() > 0)
-				destroy_allocation = UpdateParticles(delta_time, layer_trait);
+				destroy_allocation = CommitParticlesUpdate(UpdateParticles(delta_time, layer_trait));
             return destroy_allocation;
 		}
 
-		bool UpdateParticles(float delta_time, layer_trait_type const * layer_trait)
+		/** resize the buffer after an update (returns true whether the allocation is to be destroyed) */
+		bool CommitParticlesUpdate(size_t remaining_particles)
+		{
+			if (remaining_particles == 0 && GetDestroyWhenEmpty())
+				return true; // destroy allocation
+			else if (remaining_particles != particles.size()) // clean buffer of all particles that have been destroyed
+				Resize(remaining_particles);
+			return false; // do not destroy allocation
+		}
+
+		/** update all particles and returns the number of remaining particles. The buffer is not resized (see CommitParticlesUpdate) */
+		size_t UpdateParticles(float delta_time, layer_trait_type const * layer_trait, size_t range_size = 0)
 		{
 			using Flags = UpdateParticle_ImplementationFlags;
 
@@ -313,45 +342,75 @@ namespace chaos
 				{
 					if constexpr (with_begin_call != 0)
 					{
-						remaining_particles = DoUpdateParticlesLoop(
+						remaining_particles = DoUpdateParticlesRanges(
 							delta_time,
 							layer_trait,
+							range_size,
 							particle_accessor,
 							layer_trait->BeginUpdateParticles(delta_time, particle_accessor, this->data), // do not use a temp variable, so it can be a left-value reference
 							this->data);
 					}
 					else
 					{
-						remaining_particles = DoUpdateParticlesLoop(delta_time, layer_trait, particle_accessor, this->data);
+						remaining_particles = DoUpdateParticlesRanges(delta_time, layer_trait, range_size, particle_accessor, this->data);
 					}
 				}
 				else if constexpr (with_begin_call != 0)
 				{
-					remaining_particles = DoUpdateParticlesLoop(
+					remaining_particles = DoUpdateParticlesRanges(
 						delta_time,
 						layer_trait,
+						range_size,
 						particle_accessor,
 						layer_trait->BeginUpdateParticles(delta_time, particle_accessor)); // do not use a temp variable, so it can be a left-value reference
 				}
 				else
 				{
-					remaining_particles = DoUpdateParticlesLoop(delta_time, layer_trait, particle_accessor);
+					remaining_particles = DoUpdateParticlesRanges(delta_time, layer_trait, range_size, particle_accessor);
 				}
 			}
 			else if constexpr (particle_implementation != 0)
 			{
-				remaining_particles = DoUpdateParticlesLoop(delta_time, layer_trait, particle_accessor);
+				remaining_particles = DoUpdateParticlesRanges(delta_time, layer_trait, range_size, particle_accessor);
 			}
 			else if constexpr (default_implementation != 0)
 			{
-				remaining_particles = DoUpdateParticlesLoop(delta_time, layer_trait, particle_accessor);
+				remaining_particles = DoUpdateParticlesRanges(delta_time, layer_trait, range_size, particle_accessor);
 			}
 
-			if (remaining_particles == 0 && GetDestroyWhenEmpty())
-				return true; // destroy allocation
-			else if (remaining_particles != particle_count) // clean buffer of all particles that have been destroyed
-				Resize(remaining_particles);
-			return false; // do not destroy allocation
+			return remaining_particles;
+		}
+
+		/** update the particles, splitting the buffer into several ranges processed in parallel (if range_size is not 0). The params (BeginUpdateParticles result, AllocationTrait) are shared by all ranges and must be immutable during the update */
+		template<typename ...PARAMS>
+		size_t DoUpdateParticlesRanges(float delta_time, layer_trait_type const* layer_trait, size_t range_size, ParticleAccessor<particle_type> particle_accessor, PARAMS && ...params)
+		{
+			size_t particle_count = particle_accessor.GetDataCount();
+			if (range_size == 0 || particle_count <= range_size)
+				return DoUpdateParticlesLoop(delta_time, layer_trait, particle_accessor, std::forward<PARAMS>(params)...);
+
+			// each range is updated and compacted on its own
+			size_t range_count = (particle_count + range_size - 1) / range_size;
+
+			std::vector<size_t> remaining_particles(range_count, 0);
+			JobManager::GetInstance()->ParallelFor(range_count, [&](size_t range_index)
+			{
+				size_t start = range_index * range_size;
+				size_t count = std::min(range_size, particle_count - start);
+				remaining_particles[range_index] = DoUpdateParticlesLoop(delta_time, layer_trait, ParticleAccessor<particle_type>(&particle_accessor[start], count, sizeof(particle_type)), params...);
+			});
+
+			// compact the ranges in order (the result is the same than a sequential update)
+			size_t j = remaining_particles[0];
+			for (size_t range_index = 1; range_index < range_count; ++range_index)
+			{
+				size_t start = range_index * range_size;
+				if (start != j)
+					for (size_t i = 0; i < remaining_particles[range_index]; ++i)
+						particle_accessor[j + i] = particle_accessor[start + i];
+				j += remaining_particles[range_index];
+			}
+			return j; // final number of particles
 		}
 
 		template<typename ...PARAMS>
@@ -84,6 +84,8 @@ namespace chaos
 		ParticleAllocationBase const* GetAllocation(size_t index) const;
 		/** clear all allocations */
 		void ClearAllAllocations();
+		/** get a counter increased whenever an allocation is added, removed or resized (to detect structure changes cheaply) */
+		uint64_t GetStructureGeneration() const { return structure_generation; }
 
 		/** get the vertex declaration */
 		virtual GPUVertexDeclaration* GetVertexDeclaration() const { return nullptr; }
@@ -96,6 +98,20 @@ namespace chaos
 		/** force GPU buffer update */
 		void SetGPUBufferDirty() { require_GPU_update = true; }
 
+		/** enable the parallel tick of the allocations (the update of the particles must be thread-safe) */
+		void SetParallelTick(bool in_parallel_tick) { parallel_tick = in_parallel_tick; }
+		/** returns whether the allocations are ticked in parallel */
+		bool IsParallelTick() const { return parallel_tick; }
+		/** change the number of particles above which an allocation is split into several ranges for parallel tick (0 to disable). All the ranges share the result of BeginUpdateParticles(...) and the AllocationTrait by reference : they must not be modified by UpdateParticle(...) */
+		void SetParallelTickRangeSize(size_t in_range_size) { parallel_tick_range_size = in_range_size; }
+		/** get the number of particles above which an allocation is split into several ranges for parallel tick */
+		size_t GetParallelTickRangeSize() const { return parallel_tick_range_size; }
+
+		/** enable the parallel generation of the vertices (only for layers whose particles give exactly one quad with ParticleToPrimitive(...)) */
+		void SetParallelVertexGeneration(bool in_parallel_vertex_generation) { parallel_vertex_generation = in_parallel_vertex_generation; }
+		/** returns whether the vertices are generated in parallel */
+		bool IsParallelVertexGeneration() const { return parallel_vertex_generation; }
+
 		/** getter on the extra data */
 		template<typename T>
 		T* GetOwnedData()
@@ -136,8 +152,14 @@ namespace chaos
 
 		/** internal method to update particles (returns true whether there was real changes) */
 		bool TickAllocations(float delta_time);
+		/** internal method to update particles in parallel (returns true whether there was real changes) */
+		bool ParallelTickAllocations(float delta_time);
 		/** internal method to only update one allocation */
 		virtual bool TickAllocation(float delta_time, ParticleAllocationBase* allocation) { return false; } // do not destroy the allocation
+		/** internal method to update the particles of one allocation without resizing its buffer (returns the number of remaining particles). May be called from any thread */
+		virtual size_t UpdateAllocationParticles(float delta_time, ParticleAllocationBase* allocation, size_t range_size) { return allocation->GetParticleCount(); }
+		/** internal method to resize the buffer of an allocation after UpdateAllocationParticles(...) (returns true whether the allocation is to be destroyed) */
+		virtual bool CommitAllocationParticles(ParticleAllocationBase* allocation, size_t remaining_particles) { return false; } // do not destroy the allocation
 
 		/** override */
 		virtual bool DoUpdateGPUResources(GPURenderer* renderer) override;
@@ -170,6 +192,14 @@ namespace chaos
 		shared_ptr<GPUMesh> mesh;
 		/** whether there was changes in particles, and a vertex array need to be recomputed */
 		bool require_GPU_update = false;
+		/** increased whenever an allocation is added, removed or resized */
+		uint64_t structure_generation = 0;
+		/** whether the allocations are ticked in parallel */
+		bool parallel_tick = false;
+		/** the number of particles above which an allocation is split into several ranges for parallel tick */
+		size_t parallel_tick_range_size = 4096;
+		/** whether the vertices are generated in parallel */
+		bool parallel_vertex_generation = false;
 };
 
 	// ==============================================================
@@ -246,6 +276,24 @@ namespace chaos
 			return false; // do not destroy the allocation
 		}
 
+		/** override */
+		virtual size_t UpdateAllocationParticles(float delta_time, ParticleAllocationBase* in_allocation, size_t range_size) override
+		{
+			ParticleAllocation<layer_trait_type>* allocation = auto_cast(in_allocation);
+			if (allocation != nullptr && allocation->GetParticleCount() > 0)
+				return allocation->UpdateParticles(delta_time, &this->data, range_size);
+			return in_allocation->GetParticleCount();
+		}
+
+		/** override */
+		virtual bool CommitAllocationParticles(ParticleAllocationBase* in_allocation, size_t remaining_particles) override
+		{
+			ParticleAllocation<layer_trait_type>* allocation = auto_cast(in_allocation);
+			if (allocation != nullptr && allocation->GetParticleCount() > 0)
+				return allocation->CommitParticlesUpdate(remaining_particles);
+			return false; // do not destroy the allocation
+		}
+
 		/** override */
 		virtual void UpdateRenderingStates(GPURenderer* renderer, bool begin) const override
 		{
@@ -260,6 +308,8 @@ namespace chaos
 
 		// convert particles into vertices
 		void ParticlesToPrimitivesLoop(PrimitiveOutput<vertex_type>& output);
+		// convert particles into vertices, with all the quads allocated at once and filled in parallel
+		void ParallelParticlesToQuads(PrimitiveOutput<vertex_type>& output);
 	};
 
 
@@ -278,6 +328,15 @@ namespace chaos
 	template<typename LAYER_TRAIT>
 	void ParticleLayer<LAYER_TRAIT>::ParticlesToPrimitivesLoop(PrimitiveOutput<vertex_type>& output)
 	{
+		if constexpr (ParticleTraitTools::CanGenerateQuadsInParallel<layer_trait_type>())
+		{
+			if (parallel_vertex_generation)
+			{
+				ParallelParticlesToQuads(output);
+				return;
+			}
+		}
+
 		size_t count = particles_allocations.size();
 		for (size_t i = 0; i < count; ++i)
 		{
@@ -291,6 +350,58 @@ namespace chaos
 		output.Flush();
 	}
 
+	template<typename LAYER_TRAIT>
+	void ParticleLayer<LAYER_TRAIT>::ParallelParticlesToQuads(PrimitiveOutput<vertex_type>& output)
+	{
+		if constexpr (ParticleTraitTools::CanGenerateQuadsInParallel<layer_trait_type>())
+		{
+			// a job is a range of particles of one allocation, and the index of its first quad
+			struct QuadJob
+			{
+				ParticleAllocation<layer_trait_type> const* allocation = nullptr;
+				size_t start = 0;
+				size_t count = 0;
+				size_t first_quad = 0;
+			};
+
+			size_t range_size = std::max(parallel_tick_range_size, size_t(1));
+
+			std::vector<QuadJob> jobs;
+			size_t quad_count = 0;
+
+			size_t count = particles_allocations.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				// get the allocation, ignore if invisible
+				ParticleAllocation<layer_trait_type>* allocation = auto_cast(particles_allocations[i].get());
+				if (!allocation->IsVisible())
+					continue;
+				// split the allocation into ranges
+				size_t particle_count = allocation->GetParticleCount();
+				for (size_t start = 0; start < particle_count; start += range_size)
+				{
+					size_t range_count = std::min(range_size, particle_count - start);
+					jobs.push_back({ allocation, start, range_count, quad_count });
+					quad_count += range_count;
+				}
+			}
+
+			// allocate all quads at once : each job writes its own part of the buffer
+			if (quad_count > 0)
+			{
+				QuadPrimitive<vertex_type> quads = output.AddQuads(quad_count);
+				JobManager::GetInstance()->ParallelFor(jobs.size(), [&jobs, &quads](size_t job_index)
+				{
+					QuadJob const& job = jobs[job_index];
+					QuadPrimitive<vertex_type> job_quads = quads;
+					job_quads += job.first_quad;
+					job.allocation->ParticlesToQuads(job_quads, job.start, job.count);
+				});
+			}
+		}
+		output.Flush();
+	}
+
 #endif
 
 }; // namespace chaos
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace chaos
 	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(UpdateRenderingStates);
 
 	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(ParticleToPrimitives);
+	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(ParticleToPrimitive);
 	CHAOS_GENERATE_CHECK_METHOD_AND_FUNCTION(BeginParticlesToPrimitives);
 
 	// ==============================================================
@@ -125,6 +126,18 @@ namespace chaos
 			return 0;
 		}
 
+		/** returns whether the particles can be written in parallel into preallocated quads (default implementation with ParticleToPrimitive(particle, quad) available) */
+		template<typename TRAIT_TYPE>
+		constexpr bool CanGenerateQuadsInParallel()
+		{
+			using particle = typename TRAIT_TYPE::particle_type;
+			using vertex = typename TRAIT_TYPE::vertex_type;
+
+			if constexpr ((GetParticleToPrimitivesImplementationType<TRAIT_TYPE>() & ParticleToPrimitive_ImplementationFlags::DEFAULT_IMPLEMENTATION) != 0)
+				return check_function_ParticleToPrimitive_v<particle const&, QuadPrimitive<vertex>&>;
+			return false;
+		}
+
 		/** returns the kind of implementation required for the particle update */
 		template<typename TRAIT_TYPE>
 		constexpr int GetUpdateParticleImplementationFlags()
@@ -153,6 +153,8 @@ namespace chaos
 			glm::ivec2 offset = glm::ivec2(0, 0);
 			/** the indices for this chunk */
 			std::vector<Tile> tile_indices;
+			/** the encoded indices for a streamed layer (tile_indices is empty, see TileLayer::DecodeTileChunk(...)) */
+			std::string encoded_data;
 		};
 
 		// ==========================================
@@ -177,6 +179,11 @@ namespace chaos
 			/** get the chunk for a given tile */
 			TileLayerChunk const* GetTileChunk(glm::ivec2 const& pos) const;
 
+			/** returns whether the chunks are kept encoded, to be decoded on demand */
+			bool IsStreamed() const { return streamed; }
+			/** decode the tiles of a chunk from its text (thread safe) */
+			static std::vector<Tile> DecodeTileChunk(char const* txt, glm::ivec2 const& chunk_size, char const* encoding, char const* compression);
+
 		protected:
 
 			/** constructor */
@@ -192,7 +199,7 @@ namespace chaos
 			/** load all chunks of tiles */
 			bool DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression);
 			/** loading buffer method */
-			std::vector<Tile> DoLoadTileChunkFromBuffer(Buffer<char> const& buffer, glm::ivec2 const& chunk_size);
+			static std::vector<Tile> DoLoadTileChunkFromBuffer(Buffer<char> const& buffer, glm::ivec2 const& chunk_size);
 			/** add some flags to tiles */
 			virtual void ComputeTileFlags();
 
@@ -204,6 +211,12 @@ namespace chaos
 			std::vector<TileLayerChunk> tile_chunks;
 			/** cache the tile size for better performance (see TileMap) */
 			glm::ivec2 tile_size = glm::ivec2(0, 0);
+			/** whether the chunks are kept encoded (infinite layer with STREAMING property) */
+			bool streamed = false;
+			/** the encoding of the chunks */
+			std::string encoding;
+			/** the compression of the chunks */
+			std::string compression;
 		};
 
 		// ==========================================
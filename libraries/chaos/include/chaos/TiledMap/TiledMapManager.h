@@ -20,21 +20,21 @@ namespace chaos
 			/** load a tiled map set */
 			Map * LoadMap(FilePathParam const & path, bool store_object = true);
 			/** load a tiled map set */
-			Map * LoadMap(FilePathParam const & path, Buffer<char> buffer, bool store_object = true);
+			Map * LoadMap(FilePathParam const & path, Buffer<char const> buffer, bool store_object = true);
 			/** load a tiled map set */
 			Map * LoadMap(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object = true);
 
 			/** load a tiled map */
 			TileSet * LoadTileSet(FilePathParam const & path, bool store_object = true);
 			/** load a tiled map */
-			TileSet * LoadTileSet(FilePathParam const & path, Buffer<char> buffer, bool store_object = true);
+			TileSet * LoadTileSet(FilePathParam const & path, Buffer<char const> buffer, bool store_object = true);
 			/** load a tiled map */
 			TileSet * LoadTileSet(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object = true);
 
 			/** load a object type set */
 			ObjectTypeSet * LoadObjectTypeSet(FilePathParam const & path, bool store_object = true);
 			/** load a object type set */
-			ObjectTypeSet * LoadObjectTypeSet(FilePathParam const & path, Buffer<char> buffer, bool store_object = true);
+			ObjectTypeSet * LoadObjectTypeSet(FilePathParam const & path, Buffer<char const> buffer, bool store_object = true);
 			/** load a object type set */
 			ObjectTypeSet * LoadObjectTypeSet(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object = true);
 
@@ -79,21 +79,21 @@ namespace chaos
 			/** internal method to load a tiled map set (with no search for exisiting items) */
 			Map * DoLoadMap(FilePathParam const & path, bool store_object);
 			/** internal method to load a tiled map set (with no search for exisiting items) */
-			Map * DoLoadMap(FilePathParam const & path, Buffer<char> buffer, bool store_object);
+			Map * DoLoadMap(FilePathParam const & path, Buffer<char const> buffer, bool store_object);
 			/** internal method to load a tiled map set (with no search for exisiting items) */
 			Map * DoLoadMap(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object);
 
 			/** internal method to load a tiled map (with no search for exisiting items) */
 			TileSet * DoLoadTileSet(FilePathParam const & path, bool store_object);
 			/** internal method to load a tiled map (with no search for exisiting items) */
-			TileSet * DoLoadTileSet(FilePathParam const & path, Buffer<char> buffer, bool store_object);
+			TileSet * DoLoadTileSet(FilePathParam const & path, Buffer<char const> buffer, bool store_object);
 			/** internal method to load a tiled map (with no search for exisiting items) */
 			TileSet * DoLoadTileSet(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object);
 
 			/** internal method to load a object type set (with no search for exisiting items) */
 			ObjectTypeSet * DoLoadObjectTypeSet(FilePathParam const & path, bool store_object);
 			/** internal method to load a object type set (with no search for exisiting items) */
-			ObjectTypeSet * DoLoadObjectTypeSet(FilePathParam const & path, Buffer<char> buffer, bool store_object);
+			ObjectTypeSet * DoLoadObjectTypeSet(FilePathParam const & path, Buffer<char const> buffer, bool store_object);
 			/** internal method to load a object type set (with no search for exisiting items) */
 			ObjectTypeSet * DoLoadObjectTypeSet(FilePathParam const & path, tinyxml2::XMLDocument const * doc, bool store_object);
 
@@ -293,6 +293,8 @@ namespace chaos
 		float forced_tick_duration = 0.0f;
 		/** maximum time slice for tick */
 		float max_tick_duration = 0.0f;
+		/** maximum time spent each tick creating the resources loaded in background (0 for no limit) */
+		float max_loading_duration = 0.005f;
 		/** whether the delta time is forced to 0 for one frame (usefull for long operations like screen capture or GPU resource reloading) */
 		bool forced_zero_tick_duration = false;
 
@@ -552,7 +552,7 @@ namespace chaos
 			bitmaps.clear();
 		}
 
-		bool Atlas::SaveAtlas(FilePathParam const & path) const
+		bool Atlas::SaveAtlas(FilePathParam const & path, AtlasBuildCache * build_cache) const
 		{
 			// decompose the filename
 			boost::filesystem::path target_dir;
@@ -566,10 +566,10 @@ namespace chaos
 					return false;
 
 			// save the atlas
-			return SaveAtlasBitmaps(target_dir, index_filename, bitmap_filename) && SaveAtlasIndex(target_dir, index_filename, bitmap_filename);
+			return SaveAtlasBitmaps(target_dir, index_filename, bitmap_filename, build_cache) && SaveAtlasIndex(target_dir, index_filename, bitmap_filename);
 		}
 
-		bool Atlas::SaveAtlasBitmaps(boost::filesystem::path const & target_dir, boost::filesystem::path const & index_filename, boost::filesystem::path const & bitmap_filename) const
+		bool Atlas::SaveAtlasBitmaps(boost::filesystem::path const & target_dir, boost::filesystem::path const & index_filename, boost::filesystem::path const & bitmap_filename, AtlasBuildCache * build_cache) const
 		{
 			bool result = true;
 			// save them
@@ -588,7 +588,13 @@ namespace chaos
 
 				boost::filesystem::path dst_filename = target_dir / GetBitmapFilename(image_format, bitmap_filename, int(i));
 
+				// the file already contains this bitmap (and has not been touched since it has been written)
+				if (build_cache != nullptr && build_cache->IsPageUnchanged(i, dst_filename))
+					continue;
+
 				result = (FreeImage_Save(image_format, image, dst_filename.string().c_str(), 0) != 0);
+				if (result && build_cache != nullptr)
+					build_cache->SetPageFile(i, dst_filename);
 
 			}
 			return result;
@@ -638,7 +644,7 @@ namespace chaos
 			boost::filesystem::path bitmap_filename;
 			SplitFilename(path, target_dir, index_filename, bitmap_filename); // will be ignored during loading, real name is read from .JSON index
 			// load the file into memory
-			Buffer<char> buffer = FileTools::LoadFile(index_filename, LoadFileFlag::ASCII | LoadFileFlag::NO_ERROR_TRACE);
+			Buffer<char const> buffer = FileTools::MapFile(index_filename, LoadFileFlag::NO_ERROR_TRACE);
 			if (buffer == nullptr)
 			{
 				Log::Error("Atlas::LoadAtlas: fail to load [%s]", index_filename.string().c_str());
@@ -647,7 +653,7 @@ namespace chaos
 
 			// parse JSON file
 			nlohmann::json json;
-			if (JSONTools::Parse(buffer.data, json))
+			if (JSONTools::Parse(buffer.data, buffer.bufsize, json))
 				return LoadAtlas(&json, target_dir);
 			return false;
 		}
@@ -862,6 +868,7 @@ namespace chaos
 			JSONTools::GetAttribute(config, "ascender", dst.ascender);
 			JSONTools::GetAttribute(config, "descender", dst.descender);
 			JSONTools::GetAttribute(config, "face_height", dst.face_height);
+			dst.InvalidateIndices();
 			JSONTools::GetAttribute(config, "elements", dst.elements);
 			return true;
 		}
@@ -883,9 +890,11 @@ namespace chaos
 		{
 			if (!LoadFromJSON(config, (NamedInterface &)dst)) // call 'super' method
 				return false;
+			dst.InvalidateIndices();
 			JSONTools::GetAttribute(config, "bitmaps", dst.bitmaps);
 			JSONTools::GetAttribute(config, "fonts", dst.fonts);
 			JSONTools::GetAttribute(config, "folders", dst.folders);
+			dst.BuildIndices(false); // the sub folders have built their own indices while loading
 			return true;
 		}
 
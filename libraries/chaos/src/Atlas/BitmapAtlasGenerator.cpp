@@ -6,6 +6,15 @@ namespace chaos
 	namespace BitmapAtlas
 	{
 
+		static EnumTools::EnumMetaData<AtlasPackingAlgorithm> const AtlasPackingAlgorithm_metadata =
+		{
+			{ AtlasPackingAlgorithm::CORNERS, "CORNERS" },
+			{ AtlasPackingAlgorithm::SKYLINE, "SKYLINE" },
+			{ AtlasPackingAlgorithm::MAX_RECTS, "MAX_RECTS" }
+		};
+
+		CHAOS_IMPLEMENT_ENUM_METHOD(AtlasPackingAlgorithm, &AtlasPackingAlgorithm_metadata, CHAOS_API);
+
 		// ========================================================================
 		// Utility functions
 		// ========================================================================
@@ -20,6 +29,7 @@ namespace chaos
 			JSONTools::GetAttribute(config, "atlas_max_width", dst.atlas_max_width);
 			JSONTools::GetAttribute(config, "atlas_max_height", dst.atlas_max_height);
 			JSONTools::GetAttribute(config, "atlas_padding", dst.atlas_padding);
+			JSONTools::GetAttribute(config, "packing_algorithm", dst.packing_algorithm);
 			JSONTools::GetAttribute(config, "background_color", dst.background_color);
 			JSONTools::GetAttribute(config, "merge_params", dst.merge_params);
 			return true;
@@ -37,15 +47,113 @@ namespace chaos
 			JSONTools::SetAttribute(json, "atlas_max_width", src.atlas_max_width);
 			JSONTools::SetAttribute(json, "atlas_max_height", src.atlas_max_height);
 			JSONTools::SetAttribute(json, "atlas_padding", src.atlas_padding);
+			JSONTools::SetAttribute(json, "packing_algorithm", src.packing_algorithm);
 			JSONTools::SetAttribute(json, "background_color", src.background_color);
 			JSONTools::SetAttribute(json, "merge_params", src.merge_params);
 			return true;
 		}
 
+		bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache::Entry& dst)
+		{
+			JSONTools::GetAttribute(config, "content_hash", dst.content_hash);
+			JSONTools::GetAttribute(config, "bitmap_index", dst.bitmap_index);
+			JSONTools::GetAttribute(config, "x", dst.x);
+			JSONTools::GetAttribute(config, "y", dst.y);
+			JSONTools::GetAttribute(config, "width", dst.width);
+			JSONTools::GetAttribute(config, "height", dst.height);
+			return true;
+		}
+
+		bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache::Entry const& src)
+		{
+			if (!PrepareSaveObjectIntoJSON(json))
+				return false;
+			JSONTools::SetAttribute(json, "content_hash", src.content_hash);
+			JSONTools::SetAttribute(json, "bitmap_index", src.bitmap_index);
+			JSONTools::SetAttribute(json, "x", src.x);
+			JSONTools::SetAttribute(json, "y", src.y);
+			JSONTools::SetAttribute(json, "width", src.width);
+			JSONTools::SetAttribute(json, "height", src.height);
+			return true;
+		}
+
+		bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache::SourceEntry& dst)
+		{
+			JSONTools::GetAttribute(config, "source_key", dst.source_key);
+			JSONTools::GetAttribute(config, "image_count", dst.image_count);
+			JSONTools::GetAttribute(config, "animation_description", dst.animation_description);
+			return true;
+		}
+
+		bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache::SourceEntry const& src)
+		{
+			if (!PrepareSaveObjectIntoJSON(json))
+				return false;
+			JSONTools::SetAttribute(json, "source_key", src.source_key);
+			JSONTools::SetAttribute(json, "image_count", src.image_count);
+			JSONTools::SetAttribute(json, "animation_description", src.animation_description);
+			return true;
+		}
+
+		bool DoLoadFromJSON(JSONReadConfiguration config, AtlasBuildCache& dst)
+		{
+			JSONTools::GetAttribute(config, "params_hash", dst.params_hash);
+			JSONTools::GetAttribute(config, "entries", dst.entries);
+			JSONTools::GetAttribute(config, "page_hashes", dst.page_hashes);
+			JSONTools::GetAttribute(config, "page_file_hashes", dst.page_file_hashes);
+			JSONTools::GetAttribute(config, "sources", dst.sources);
+			return true;
+		}
+
+		bool DoSaveIntoJSON(nlohmann::json * json, AtlasBuildCache const& src)
+		{
+			if (!PrepareSaveObjectIntoJSON(json))
+				return false;
+			JSONTools::SetAttribute(json, "params_hash", src.params_hash);
+			JSONTools::SetAttribute(json, "entries", src.entries);
+			JSONTools::SetAttribute(json, "page_hashes", src.page_hashes);
+			JSONTools::SetAttribute(json, "page_file_hashes", src.page_file_hashes);
+			JSONTools::SetAttribute(json, "sources", src.sources);
+			return true;
+		}
+
 		// ========================================================================
 		// Utility functions
 		// ========================================================================
 
+		/** FNV-1a hash of a buffer */
+		static uint64_t HashBytes(void const * data, size_t size, uint64_t hash = 14695981039346656037ULL)
+		{
+			unsigned char const * bytes = (unsigned char const *)data;
+			for (size_t i = 0; i < size; ++i)
+			{
+				hash ^= bytes[i];
+				hash *= 1099511628211ULL;
+			}
+			return hash;
+		}
+
+		/** hash of the size, the format and the pixels of an image */
+		static uint64_t HashImage(ImageDescription const & description)
+		{
+			int header[4] = { description.width, description.height, int(description.pixel_format.component_type), description.pixel_format.component_count };
+
+			uint64_t result = HashBytes(header, sizeof(header));
+			if (description.data != nullptr)
+				for (int y = 0; y < description.height; ++y)
+					result = HashBytes((char const *)description.data + y * description.pitch_size, description.line_size, result);
+			return result;
+		}
+
+		/** hash of the content of a file (0 if it cannot be read) */
+		static uint64_t HashFile(FilePathParam const & path, uint64_t hash = 14695981039346656037ULL)
+		{
+			Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE);
+			if (buffer == nullptr)
+				return 0;
+			return HashBytes(buffer.data, buffer.bufsize, hash);
+		}
+
 		static BitmapLayout * GetBitmapLayout(BitmapInfoInput * info)
 		{
 			if (info->bitmap_output_info != nullptr)
@@ -112,6 +220,234 @@ namespace chaos
 			return true;
 		}
 
+		// ========================================================================
+		// AtlasBuildCache implementation
+		// ========================================================================
+
+		bool AtlasBuildCache::LoadCache(FilePathParam const & path)
+		{
+			nlohmann::json json;
+			if (!JSONTools::LoadJSONFile(path, json, LoadFileFlag::NO_ERROR_TRACE))
+				return false;
+			if (!LoadFromJSON(&json, *this))
+				return false;
+
+			boost::lock_guard<boost::mutex> lock(sources_mutex);
+			source_indices.clear();
+			for (size_t i = 0; i < sources.size(); ++i)
+				source_indices[sources[i].source_key] = i;
+			return true;
+		}
+
+		bool AtlasBuildCache::SaveCache(FilePathParam const & path) const
+		{
+			nlohmann::json json;
+			if (!SaveIntoJSON(&json, *this))
+				return false;
+			return JSONTools::SaveJSONToFile(&json, path);
+		}
+
+		bool AtlasBuildCache::IsPageUnchanged(size_t index, FilePathParam const & path) const
+		{
+			if (index >= unchanged_pages.size() || !unchanged_pages[index])
+				return false;
+			// the file may have been modified or replaced since it has been saved
+			if (index >= page_file_hashes.size() || page_file_hashes[index] == 0)
+				return false;
+			return (HashFile(path) == page_file_hashes[index]);
+		}
+
+		void AtlasBuildCache::SetGeneration(uint64_t in_params_hash, std::vector<Entry> in_entries, std::vector<uint64_t> in_page_hashes)
+		{
+			// compare with the previous generation
+			unchanged_pages.clear();
+			for (size_t i = 0; i < in_page_hashes.size(); ++i)
+				unchanged_pages.push_back(i < page_hashes.size() && page_hashes[i] == in_page_hashes[i]);
+
+			params_hash = in_params_hash;
+			entries = std::move(in_entries);
+			page_hashes = std::move(in_page_hashes);
+			page_file_hashes.resize(page_hashes.size(), 0);
+		}
+
+		void AtlasBuildCache::SetPageFile(size_t index, FilePathParam const & path)
+		{
+			if (page_file_hashes.size() <= index)
+				page_file_hashes.resize(index + 1, 0);
+			page_file_hashes[index] = HashFile(path);
+		}
+
+		uint64_t AtlasBuildCache::ComputeSourceKey(BitmapFileLoadData const & load_data)
+		{
+			// the name (that may describe an animation grid) and the manifest (with the image processors)
+			std::string description = load_data.path.string() + load_data.json_manifest.dump();
+			uint64_t result = HashBytes(description.c_str(), description.size());
+
+			// the content of the files
+			if (load_data.frames_directory.empty())
+				return HashFile(load_data.path, result);
+
+			std::vector<boost::filesystem::path> frame_paths;
+			FileTools::WithDirectoryContent(load_data.frames_directory, [&frame_paths](boost::filesystem::path const & p)
+			{
+				if (boost::filesystem::status(p).type() == boost::filesystem::file_type::regular_file)
+					frame_paths.push_back(p);
+				return false; // don't stop
+			});
+			std::sort(frame_paths.begin(), frame_paths.end());
+			for (boost::filesystem::path const & p : frame_paths)
+			{
+				std::string frame_name = p.filename().string();
+				result = HashBytes(frame_name.c_str(), frame_name.size(), result);
+				result = HashFile(p, result);
+			}
+			return result;
+		}
+
+		boost::filesystem::path AtlasBuildCache::GetSourceImagePath(uint64_t source_key, int image_index) const
+		{
+			return image_directory / StringTools::Printf("%016llx_%d.bin", (unsigned long long)source_key, image_index);
+		}
+
+		bool AtlasBuildCache::LoadSourceImages(uint64_t source_key, std::vector<FIBITMAP*> & images, ImageAnimationDescription & animation_description)
+		{
+			if (image_directory.empty())
+				return false;
+
+			SourceEntry source;
+			{
+				boost::lock_guard<boost::mutex> lock(sources_mutex);
+				auto it = source_indices.find(source_key);
+				if (it == source_indices.end())
+					return false;
+				source = sources[it->second];
+			}
+
+			// read the raw pixels of each image
+			std::vector<FIBITMAP*> result;
+			for (int i = 0; i < source.image_count; ++i)
+			{
+				FIBITMAP * image = nullptr;
+
+				std::ifstream stream(GetSourceImagePath(source_key, i).string().c_str(), std::ios::binary);
+				int header[4] = { 0, 0, 0, 0 }; // width, height, component type, component count
+				if (stream.read((char *)header, sizeof(header)))
+				{
+					PixelFormat pixel_format = PixelFormat(PixelComponentType(header[2]), header[3]);
+					if (pixel_format.IsValid() && header[0] > 0 && header[1] > 0)
+						image = ImageTools::GenFreeImage(pixel_format, header[0], header[1]);
+				}
+				if (image != nullptr)
+				{
+					ImageDescription description = ImageTools::GetImageDescription(image);
+					for (int y = 0; y < description.height && image != nullptr; ++y)
+					{
+						if (!stream.read((char *)description.data + y * description.pitch_size, description.line_size))
+						{
+							FreeImage_Unload(image);
+							image = nullptr;
+						}
+					}
+				}
+				if (image == nullptr)
+				{
+					for (FIBITMAP * other_image : result)
+						FreeImage_Unload(other_image);
+					return false;
+				}
+				result.push_back(image);
+			}
+
+			{
+				boost::lock_guard<boost::mutex> lock(sources_mutex);
+				auto it = source_indices.find(source_key);
+				if (it != source_indices.end())
+					sources[it->second].used = true;
+			}
+			images = std::move(result);
+			animation_description = source.animation_description;
+			return true;
+		}
+
+		bool AtlasBuildCache::SaveSourceImages(uint64_t source_key, std::vector<FIBITMAP*> const & images, ImageAnimationDescription const & animation_description)
+		{
+			if (image_directory.empty())
+				return false;
+			if (!boost::filesystem::is_directory(image_directory))
+			{
+				boost::system::error_code error_code;
+				boost::filesystem::create_directories(image_directory, error_code); // several threads may create it
+				if (!boost::filesystem::is_directory(image_directory))
+					return false;
+			}
+
+			// write the raw pixels of each image
+			for (size_t i = 0; i < images.size(); ++i)
+			{
+				ImageDescription description = ImageTools::GetImageDescription(images[i]);
+				if (!description.IsValid(false))
+					return false;
+
+				std::ofstream stream(GetSourceImagePath(source_key, int(i)).string().c_str(), std::ios::binary);
+				int header[4] = { description.width, description.height, int(description.pixel_format.component_type), description.pixel_format.component_count };
+				stream.write((char const *)header, sizeof(header));
+				for (int y = 0; y < description.height; ++y)
+					stream.write((char const *)description.data + y * description.pitch_size, description.line_size);
+				if (!stream)
+					return false;
+			}
+
+			// register the source
+			SourceEntry source;
+			source.source_key = source_key;
+			source.image_count = int(images.size());
+			source.animation_description = animation_description;
+			source.used = true;
+
+			boost::lock_guard<boost::mutex> lock(sources_mutex);
+			auto it = source_indices.find(source_key);
+			if (it != source_indices.end())
+			{
+				sources[it->second] = source;
+			}
+			else
+			{
+				source_indices[source_key] = sources.size();
+				sources.push_back(source);
+			}
+			return true;
+		}
+
+		void AtlasBuildCache::RemoveUnusedSources()
+		{
+			boost::lock_guard<boost::mutex> lock(sources_mutex);
+
+			size_t count = 0;
+			for (size_t i = 0; i < sources.size(); ++i)
+			{
+				if (!sources[i].used)
+				{
+					if (!image_directory.empty())
+					{
+						for (int j = 0; j < sources[i].image_count; ++j)
+						{
+							boost::system::error_code error_code;
+							boost::filesystem::remove(GetSourceImagePath(sources[i].source_key, j), error_code);
+						}
+					}
+					continue;
+				}
+				if (i != count)
+					sources[count] = sources[i];
+				++count;
+			}
+			sources.resize(count);
+
+			source_indices.clear();
+			for (size_t i = 0; i < sources.size(); ++i)
+				source_indices[sources[i].source_key] = i;
+		}
+
 		// ========================================================================
 		// AtlasGenerator implementation
 		// ========================================================================
@@ -122,6 +458,8 @@ namespace chaos
 			input = nullptr;
 			output = nullptr;
 			atlas_definitions.clear();
+			params_hash = 0;
+			content_hashes.clear();
 		}
 
 		Rectangle AtlasGenerator::GetAtlasRectangle() const
@@ -197,27 +535,45 @@ namespace chaos
 			}
 
 			// test whether a collision exists between 2 elements
-			size_t count = entries.size();
-			for (size_t i = 0; i < count - 1; ++i)
+			// XXX : the rectangles are sorted by page and left side, so that each one is only tested against the ones that start before its right side
+			std::vector<std::pair<Rectangle, size_t>> sorted_rectangles;
+			sorted_rectangles.reserve(entries.size());
+			for (size_t i = 0; i < entries.size(); ++i)
+				if (BitmapLayout const * layout = GetBitmapLayout(entries[i]))
+					sorted_rectangles.emplace_back(AddPadding(GetRectangle(*layout)), i);
+
+			auto GetBitmapIndex = [&entries](size_t entry_index)
 			{
-				for (size_t j = i + 1; j < count; ++j)
-				{
-					BitmapLayout const * layout1 = GetBitmapLayout(entries[i]);
-					BitmapLayout const * layout2 = GetBitmapLayout(entries[j]);
+				return GetBitmapLayout(entries[entry_index])->bitmap_index;
+			};
 
-					if (layout1 == nullptr || layout2 == nullptr)
-						continue;
+			std::sort(sorted_rectangles.begin(), sorted_rectangles.end(), [&GetBitmapIndex](auto const& src1, auto const& src2)
+			{
+				int bitmap_index1 = GetBitmapIndex(src1.second);
+				int bitmap_index2 = GetBitmapIndex(src2.second);
+				if (bitmap_index1 != bitmap_index2)
+					return (bitmap_index1 < bitmap_index2);
+				return (src1.first.x < src2.first.x);
+			});
 
-					if (layout1->bitmap_index != layout2->bitmap_index) // ignore entries not in the same bitmap
-						continue;
+			size_t count = sorted_rectangles.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				Rectangle const & r1 = sorted_rectangles[i].first;
 
-					Rectangle r1 = AddPadding(GetRectangle(*layout1));
-					Rectangle r2 = AddPadding(GetRectangle(*layout2));
+				for (size_t j = i + 1; j < count; ++j)
+				{
+					Rectangle const & r2 = sorted_rectangles[j].first;
+
+					if (GetBitmapIndex(sorted_rectangles[i].second) != GetBitmapIndex(sorted_rectangles[j].second)) // no more entry in the same bitmap
+						break;
+					if (r2.x >= r1.x + r1.width) // no more entry that may intersect
+						break;
 
 					if (r1.IsIntersecting(r2))
 					{
-						NamedInterface const * named1 = GetNamedObject(entries[i]);
-						NamedInterface const * named2 = GetNamedObject(entries[j]);
+						NamedInterface const * named1 = GetNamedObject(entries[sorted_rectangles[i].second]);
+						NamedInterface const * named2 = GetNamedObject(entries[sorted_rectangles[j].second]);
 
 						if (named1 != nullptr && named2 != nullptr)
 						{
@@ -242,11 +598,13 @@ namespace chaos
 
 		std::vector<bitmap_ptr> AtlasGenerator::GenerateBitmaps(BitmapInfoInputVector const & entries, PixelFormat const & final_pixel_format) const
 		{
-			std::vector<bitmap_ptr> result;
+			JobManager* job_manager = JobManager::GetInstance();
 
 			// generate the bitmaps
 			size_t bitmap_count = atlas_definitions.size();
-			for (size_t i = 0; i < bitmap_count; ++i)
+
+			std::vector<bitmap_ptr> bitmaps(bitmap_count);
+			job_manager->ParallelFor(bitmap_count, [this, &bitmaps, &final_pixel_format](size_t i)
 			{
 				bitmap_ptr bitmap = bitmap_ptr(ImageTools::GenFreeImage(final_pixel_format, params.atlas_width, params.atlas_height));
 				if (bitmap != nullptr)
@@ -255,70 +613,84 @@ namespace chaos
 					ImageDescription image_description = ImageTools::GetImageDescription(bitmap.get());
 
 					ImageTools::FillImageBackground(image_description, params.background_color);
+				}
+				bitmaps[i] = std::move(bitmap);
+			});
 
-					// copy-paste all entries
-					for (BitmapInfoInput const * entry_input : entries)
-					{
-						BitmapLayout const * layout = GetBitmapLayout(entry_input);
-						if (layout == nullptr)
-							continue;
+			// copy-paste all entries
+			// XXX : the padded rectangles of the entries do not intersect each others (even with the duplicated borders)
+			//       so that all entries can be copied in parallel, and the result does not depend on the threads
+			job_manager->ParallelFor(entries.size(), [this, &bitmaps, &entries](size_t entry_index)
+			{
+				BitmapInfoInput const * entry_input = entries[entry_index];
 
-						if (layout->bitmap_index != i)
-							continue;
-						if (entry_input->description.IsEmpty(false))
-							continue;
+				BitmapLayout const * layout = GetBitmapLayout(entry_input);
+				if (layout == nullptr)
+					return;
 
-						// beware, according to FreeImage, the coordinate origin is top-left
-						// to match with OpenGL (bottom-left), we have to make a swap
-						int tex_x = layout->x;
-						int tex_y = params.atlas_height - layout->y - layout->height;
+				if (layout->bitmap_index < 0 || layout->bitmap_index >= int(bitmaps.size()))
+					return;
+				if (entry_input->description.IsEmpty(false))
+					return;
 
-						// copy and convert pixels
-						ImageDescription src_desc = entry_input->description;
-						ImageDescription dst_desc = ImageTools::GetImageDescription(bitmap.get());
+				FIBITMAP* bitmap = bitmaps[layout->bitmap_index].get();
+				if (bitmap == nullptr)
+					return;
 
+				// beware, according to FreeImage, the coordinate origin is top-left
+				// to match with OpenGL (bottom-left), we have to make a swap
+				int tex_x = layout->x;
+				int tex_y = params.atlas_height - layout->y - layout->height;
 
-						int w = src_desc.width;
-						int h = src_desc.height;
+				// copy and convert pixels
+				ImageDescription src_desc = entry_input->description;
+				ImageDescription dst_desc = ImageTools::GetImageDescription(bitmap);
 
 
-						ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x, tex_y, w, src_desc.height, ImageTransform::NO_TRANSFORM);
+				int w = src_desc.width;
+				int h = src_desc.height;
 
 
-						// XXX:
-						// Duplicate the first/last rows/column of each subimage so that the sampling errors would give us a duplicate value
-						// this force to have a padding of a least 1 (each image have its own padding zone)
-						//
-						// +------+
-						// |+----+|
-						// ||    || Double border
-						// |+----+|
-						// +------+
+				ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x, tex_y, w, src_desc.height, ImageTransform::NO_TRANSFORM);
 
-						if (params.duplicate_image_border) // shu47
-						{
-							// XXX : it is possible to index dst texture to outside the range reserved surface (the double border) because
-							//       dst_desc is descriptor on the whole image
-							//       (we force a padding of at least 1)
 
-							// 4 edges
-							ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x, tex_y - 1, w, 1, ImageTransform::NO_TRANSFORM);
-							ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x - 1, tex_y, 1, h, ImageTransform::NO_TRANSFORM);
+				// XXX:
+				// Duplicate the first/last rows/column of each subimage so that the sampling errors would give us a duplicate value
+				// this force to have a padding of a least 1 (each image have its own padding zone)
+				//
+				// +------+
+				// |+----+|
+				// ||    || Double border
+				// |+----+|
+				// +------+
 
-							ImageTools::CopyPixels(src_desc, dst_desc, 0, h - 1, tex_x, tex_y + h, w, 1, ImageTransform::NO_TRANSFORM);
-							ImageTools::CopyPixels(src_desc, dst_desc, w - 1, 0, tex_x + w, tex_y, 1, h, ImageTransform::NO_TRANSFORM);
+				if (params.duplicate_image_border) // shu47
+				{
+					// XXX : it is possible to index dst texture to outside the range reserved surface (the double border) because
+					//       dst_desc is descriptor on the whole image
+					//       (we force a padding of at least 1)
 
-							// 4 extra corners
-							ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x - 1, tex_y - 1, 1, 1, ImageTransform::NO_TRANSFORM);
-							ImageTools::CopyPixels(src_desc, dst_desc, w - 1, 0, tex_x + w, tex_y - 1, 1, 1, ImageTransform::NO_TRANSFORM);
+					// 4 edges
+					ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x, tex_y - 1, w, 1, ImageTransform::NO_TRANSFORM);
+					ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x - 1, tex_y, 1, h, ImageTransform::NO_TRANSFORM);
 
-							ImageTools::CopyPixels(src_desc, dst_desc, 0, h - 1, tex_x - 1, tex_y + h, 1, 1, ImageTransform::NO_TRANSFORM);
-							ImageTools::CopyPixels(src_desc, dst_desc, w - 1, h - 1, tex_x + w, tex_y + h, 1, 1, ImageTransform::NO_TRANSFORM);
-						}
-					}
-					result.push_back(std::move(bitmap));
+					ImageTools::CopyPixels(src_desc, dst_desc, 0, h - 1, tex_x, tex_y + h, w, 1, ImageTransform::NO_TRANSFORM);
+					ImageTools::CopyPixels(src_desc, dst_desc, w - 1, 0, tex_x + w, tex_y, 1, h, ImageTransform::NO_TRANSFORM);
+
+					// 4 extra corners
+					ImageTools::CopyPixels(src_desc, dst_desc, 0, 0, tex_x - 1, tex_y - 1, 1, 1, ImageTransform::NO_TRANSFORM);
+					ImageTools::CopyPixels(src_desc, dst_desc, w - 1, 0, tex_x + w, tex_y - 1, 1, 1, ImageTransform::NO_TRANSFORM);
+
+					ImageTools::CopyPixels(src_desc, dst_desc, 0, h - 1, tex_x - 1, tex_y + h, 1, 1, ImageTransform::NO_TRANSFORM);
+					ImageTools::CopyPixels(src_desc, dst_desc, w - 1, h - 1, tex_x + w, tex_y + h, 1, 1, ImageTransform::NO_TRANSFORM);
 				}
-			}
+			});
+
+			// keep the bitmaps that have been generated
+			std::vector<bitmap_ptr> result;
+			for (bitmap_ptr & bitmap : bitmaps)
+				if (bitmap != nullptr)
+					result.push_back(std::move(bitmap));
 			return result;
 		}
 
@@ -345,6 +717,7 @@ namespace chaos
 				child_folder_info_output->SetTag(child_folder_info_input->GetTag());
 
 				folder_info_output->folders.push_back(std::move(std::unique_ptr<FolderInfo>(child_folder_info_output)));
+				folder_info_output->InvalidateIndices();
 				FillAtlasEntriesFromInput(result, child_folder_info_input, child_folder_info_output);
 			}
 
@@ -367,6 +740,7 @@ namespace chaos
 				bitmap_info_output.height = bitmap_info_input->description.height;
 
 				folder_info_output->bitmaps.push_back(std::move(bitmap_info_output));
+				folder_info_output->InvalidateIndices();
 			}
 
 			// once we are sure that Folder.Bitmaps does not resize anymore, we can store pointers
@@ -442,7 +816,9 @@ namespace chaos
 
 					font_info_output.elements.push_back(std::move(character_info_output));
 				}
+				font_info_output.InvalidateIndices();
 				folder_info_output->fonts.push_back(std::move(font_info_output));
+				folder_info_output->InvalidateIndices();
 			}
 			// once we are sure that Folder.Fonts vector does not resize anymore, we can store pointers
 			for (size_t i = 0; i < font_count; ++i)
@@ -534,6 +910,10 @@ namespace chaos
 			if (params.atlas_max_height > 0 && params.atlas_max_height < params.atlas_height)
 				return false;
 
+			// the hashes are used to reuse the result of a previous generation
+			if (build_cache != nullptr)
+				ComputeHashes(entries, final_pixel_format);
+
 			// ensure this can be produced inside an atlas with size_restriction
 			if (DoComputeResult(entries))
 			{
@@ -544,6 +924,14 @@ namespace chaos
 					output->bitmaps = GenerateBitmaps(entries, final_pixel_format);
 					output->atlas_count = int(output->bitmaps.size());
 					output->dimension = glm::ivec2(params.atlas_width, params.atlas_height);
+					output->root_folder.BuildIndices();
+					if (build_cache != nullptr)
+					{
+						UpdateBuildCache(entries);
+						// the sources of the input have been searched in this cache : the other ones are obsolete
+						if (in_input.GetBuildCache() == build_cache)
+							build_cache->RemoveUnusedSources();
+					}
 					return true;
 				}
 			}
@@ -569,9 +957,16 @@ namespace chaos
 				return false;
 			});
 
+			// the entries that did not change keep their previous position
+			std::vector<bool> placed(count, false);
+			if (build_cache != nullptr)
+				ReuseCachedPositions(entries, placed);
+
 			for (size_t i = 0; i < count; ++i)
 			{
 				size_t entry_index = textures_indirection_table[i];
+				if (placed[entry_index])
+					continue;
 
 				BitmapInfoInput const * input_entry = entries[entry_index];
 
@@ -606,8 +1001,7 @@ namespace chaos
 				if (best_atlas_index == -1) // not enough size in any existing atlas. create a new one
 				{
 					AtlasDefinition def;
-
-					def.potential_bottomleft_corners.push_back(glm::ivec2(0, 0));
+					InitializeAtlasDefinition(def);
 
 					best_atlas_index = int(atlas_definitions.size());
 					best_position = glm::ivec2(0, 0);
@@ -619,9 +1013,163 @@ namespace chaos
 				if (layout != nullptr)
 					InsertBitmapLayoutInAtlas(*layout, atlas_definitions[best_atlas_index], best_position);
 			}
+
+			// some pages of the build cache may have lost all their entries
+			if (build_cache != nullptr)
+				RemoveEmptyAtlasDefinitions(entries);
 			return true;
 		}
 
+		void AtlasGenerator::ComputeHashes(BitmapInfoInputVector const & entries, PixelFormat const & final_pixel_format)
+		{
+			// the parameters (with the final size of the atlas)
+			nlohmann::json json;
+			SaveIntoJSON(&json, params);
+			JSONTools::SetAttribute(&json, "pixel_format", final_pixel_format);
+			if (params.filters != nullptr)
+				JSONTools::SetAttribute(&json, "filters", *params.filters);
+
+			std::string params_string = json.dump();
+			params_hash = HashBytes(params_string.c_str(), params_string.size());
+
+			// the pixels of the entries
+			content_hashes.resize(entries.size());
+			JobManager::GetInstance()->ParallelFor(entries.size(), [this, &entries](size_t index)
+			{
+				content_hashes[index] = HashImage(entries[index]->description);
+			});
+		}
+
+		void AtlasGenerator::ReuseCachedPositions(BitmapInfoInputVector const & entries, std::vector<bool> & placed)
+		{
+			// the atlas would not be the same
+			if (build_cache->GetParamsHash() != params_hash)
+				return;
+
+			// several entries may have the same content : they are matched in order
+			std::unordered_map<uint64_t, std::vector<AtlasBuildCache::Entry const *>> cached_entries;
+			for (AtlasBuildCache::Entry const & cached_entry : build_cache->GetEntries())
+				cached_entries[cached_entry.content_hash].push_back(&cached_entry);
+
+			std::unordered_map<uint64_t, size_t> used_cached_entries;
+
+			Rectangle atlas_rectangle = GetAtlasRectangle();
+
+			size_t count = entries.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				BitmapLayout * layout = GetBitmapLayout(entries[i]);
+				if (layout == nullptr)
+					continue;
+
+				auto it = cached_entries.find(content_hashes[i]);
+				if (it == cached_entries.end())
+					continue;
+				size_t & used = used_cached_entries[content_hashes[i]];
+				if (used >= it->second.size())
+					continue;
+				AtlasBuildCache::Entry const * cached_entry = it->second[used++];
+
+				// ensure the cached entry is valid
+				if (cached_entry->bitmap_index < 0 || cached_entry->width != layout->width || cached_entry->height != layout->height)
+					continue;
+
+				Rectangle r;
+				r.x = cached_entry->x;
+				r.y = cached_entry->y;
+				r.width = cached_entry->width;
+				r.height = cached_entry->height;
+				if (!AddPadding(r).IsFullyInside(atlas_rectangle))
+					continue;
+
+				// create the pages as long as necessary
+				while (atlas_definitions.size() <= size_t(cached_entry->bitmap_index))
+				{
+					AtlasDefinition def;
+					InitializeAtlasDefinition(def);
+					atlas_definitions.push_back(std::move(def));
+				}
+
+				InsertBitmapLayoutInAtlas(*layout, atlas_definitions[cached_entry->bitmap_index], glm::ivec2(r.x - params.atlas_padding, r.y - params.atlas_padding));
+				placed[i] = true;
+			}
+		}
+
+		void AtlasGenerator::RemoveEmptyAtlasDefinitions(BitmapInfoInputVector const & entries)
+		{
+			// count the entries on each page
+			std::vector<size_t> entry_count(atlas_definitions.size(), 0);
+			for (BitmapInfoInput * entry : entries)
+				if (BitmapLayout const * layout = GetBitmapLayout(entry))
+					if (layout->bitmap_index >= 0)
+						++entry_count[layout->bitmap_index];
+
+			// compute the new index of each page
+			std::vector<int> new_index(atlas_definitions.size(), -1);
+
+			size_t page_count = 0;
+			for (size_t i = 0; i < atlas_definitions.size(); ++i)
+			{
+				if (entry_count[i] == 0)
+					continue;
+				if (i != page_count)
+					atlas_definitions[page_count] = std::move(atlas_definitions[i]);
+				new_index[i] = int(page_count++);
+			}
+
+			if (page_count == atlas_definitions.size())
+				return;
+			atlas_definitions.resize(page_count);
+
+			for (BitmapInfoInput * entry : entries)
+				if (BitmapLayout * layout = GetBitmapLayout(entry))
+					if (layout->bitmap_index >= 0)
+						layout->bitmap_index = new_index[layout->bitmap_index];
+		}
+
+		void AtlasGenerator::UpdateBuildCache(BitmapInfoInputVector const & entries)
+		{
+			std::vector<uint64_t> page_hashes(atlas_definitions.size(), params_hash);
+
+			// the new entries (and the content of each page)
+			std::vector<AtlasBuildCache::Entry> cached_entries;
+			std::vector<std::vector<AtlasBuildCache::Entry>> page_entries(atlas_definitions.size());
+
+			size_t count = entries.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				BitmapLayout const * layout = GetBitmapLayout(entries[i]);
+				if (layout == nullptr || layout->bitmap_index < 0)
+					continue;
+
+				AtlasBuildCache::Entry cached_entry;
+				cached_entry.content_hash = content_hashes[i];
+				cached_entry.bitmap_index = layout->bitmap_index;
+				cached_entry.x = layout->x;
+				cached_entry.y = layout->y;
+				cached_entry.width = layout->width;
+				cached_entry.height = layout->height;
+				cached_entries.push_back(cached_entry);
+				page_entries[layout->bitmap_index].push_back(cached_entry);
+			}
+
+			// the hash of a page does not depend on the order of the entries
+			for (size_t i = 0; i < page_entries.size(); ++i)
+			{
+				std::sort(page_entries[i].begin(), page_entries[i].end(), [](AtlasBuildCache::Entry const & src1, AtlasBuildCache::Entry const & src2)
+				{
+					return std::make_tuple(src1.x, src1.y, src1.content_hash) < std::make_tuple(src2.x, src2.y, src2.content_hash);
+				});
+				for (AtlasBuildCache::Entry const & cached_entry : page_entries[i])
+				{
+					uint64_t values[3] = { cached_entry.content_hash, uint64_t(cached_entry.x), uint64_t(cached_entry.y) };
+					page_hashes[i] = HashBytes(values, sizeof(values), page_hashes[i]);
+				}
+			}
+
+			build_cache->SetGeneration(params_hash, std::move(cached_entries), std::move(page_hashes));
+		}
+
 		float AtlasGenerator::FindBestPositionInAtlas(BitmapInfoInputVector const & entries, BitmapInfoInput const & info, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
 		{
 			// not enought surface remaining. Early exit
@@ -638,6 +1186,38 @@ namespace chaos
 			r.width  = info.description.width + 2 * params.atlas_padding;
 			r.height = info.description.height + 2 * params.atlas_padding;
 
+			bool found = false;
+			if (params.packing_algorithm == AtlasPackingAlgorithm::SKYLINE)
+				found = FindSkylinePosition(r, atlas_def, position);
+			else if (params.packing_algorithm == AtlasPackingAlgorithm::MAX_RECTS)
+				found = FindMaxRectsPosition(r, atlas_def, position);
+			else
+				found = FindCornerPosition(r, atlas_def, position);
+
+			return (found) ? 0.0f : -1.0f; // the first page with a valid position is used
+		}
+
+		void AtlasGenerator::InitializeAtlasDefinition(AtlasDefinition & atlas_def) const
+		{
+			if (params.packing_algorithm == AtlasPackingAlgorithm::SKYLINE)
+			{
+				SkylineSegment segment;
+				segment.width = params.atlas_width;
+				atlas_def.skyline.push_back(segment);
+			}
+			else if (params.packing_algorithm == AtlasPackingAlgorithm::MAX_RECTS)
+			{
+				atlas_def.free_rectangles.push_back(GetAtlasRectangle());
+			}
+			else
+			{
+				atlas_def.potential_bottomleft_corners.push_back(glm::ivec2(0, 0));
+			}
+		}
+
+		bool AtlasGenerator::FindCornerPosition(Rectangle const & in_r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			Rectangle r = in_r;
 			for (glm::ivec2 const& p : atlas_def.potential_bottomleft_corners)
 			{
 				// position of the rectangle (padding included)
@@ -652,10 +1232,202 @@ namespace chaos
 				if (!HasIntersectingInfo(r, atlas_def.collision_rectangles))
 				{
 					position = p;
-					return 0.0f; // perfect fit
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void AtlasGenerator::InsertCornerRectangle(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			glm::ivec2 position = glm::ivec2(r.x, r.y);
+
+			// erase the point from potential entries
+			auto it = std::find(atlas_def.potential_bottomleft_corners.begin(), atlas_def.potential_bottomleft_corners.end(), position);
+			if (it != atlas_def.potential_bottomleft_corners.end())
+				atlas_def.potential_bottomleft_corners.erase(it);
+
+			// insert 3 new corners as entries (bottom-right / top-left / top-right)
+			atlas_def.potential_bottomleft_corners.emplace_back(r.x + r.width, r.y);
+			atlas_def.potential_bottomleft_corners.emplace_back(r.x, r.y + r.height);
+			atlas_def.potential_bottomleft_corners.emplace_back(r.x + r.width, r.y + r.height);
+
+			// insert new rectangle to test for collision
+			atlas_def.collision_rectangles.push_back(r);
+		}
+
+		bool AtlasGenerator::FindSkylinePosition(Rectangle const & r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			std::vector<SkylineSegment> const & skyline = atlas_def.skyline;
+
+			int best_top = std::numeric_limits<int>::max();
+			int best_waste = std::numeric_limits<int>::max();
+
+			size_t count = skyline.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				int x = skyline[i].x;
+				if (x + r.width > params.atlas_width) // segments are sorted by x : no further segment can be used
+					break;
+
+				// the rectangle lies on the highest segment under it
+				int y = 0;
+				for (size_t j = i; j < count && skyline[j].x < x + r.width; ++j)
+					y = std::max(y, skyline[j].y);
+
+				int top = y + r.height;
+				if (top > params.atlas_height || top > best_top)
+					continue;
+
+				// the space lost under the rectangle
+				int waste = 0;
+				for (size_t j = i; j < count && skyline[j].x < x + r.width; ++j)
+					waste += (y - skyline[j].y) * (std::min(skyline[j].x + skyline[j].width, x + r.width) - skyline[j].x);
+
+				if (top < best_top || waste < best_waste)
+				{
+					best_top = top;
+					best_waste = waste;
+					position = glm::ivec2(x, y);
 				}
 			}
-			return -1.0f; // not found on this page
+			return (best_top != std::numeric_limits<int>::max());
+		}
+
+		void AtlasGenerator::InsertSkylineRectangle(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			std::vector<SkylineSegment> & skyline = atlas_def.skyline;
+
+			// raise the segments under the rectangle (a rectangle coming from the build cache may not lie on the skyline)
+			int left = r.x;
+			int right = r.x + r.width;
+			int top = r.y + r.height;
+
+			// the first segment that ends after the left border of the rectangle
+			size_t first = size_t(std::upper_bound(skyline.begin(), skyline.end(), left, [](int value, SkylineSegment const & segment)
+			{
+				return value < segment.x + segment.width;
+			}) - skyline.begin());
+			if (first == skyline.size())
+				return;
+
+			// split the segment crossing the left border
+			if (skyline[first].x < left)
+			{
+				SkylineSegment segment = skyline[first];
+				skyline[first].width = left - segment.x;
+				skyline.insert(skyline.begin() + first + 1, { left, segment.y, segment.x + segment.width - left });
+				++first;
+			}
+
+			// raise the covered segments (splitting the one crossing the right border)
+			size_t last = first;
+			for (; last < skyline.size() && skyline[last].x < right; ++last)
+			{
+				SkylineSegment segment = skyline[last];
+				if (segment.x + segment.width > right)
+				{
+					skyline[last].width = right - segment.x;
+					skyline.insert(skyline.begin() + last + 1, { right, segment.y, segment.x + segment.width - right });
+				}
+				skyline[last].y = std::max(segment.y, top);
+			}
+
+			// merge the neighbours with the same height (only the modified range and its borders may be concerned)
+			size_t begin = (first > 0) ? first - 1 : 0;
+			size_t end = std::min(last + 1, skyline.size());
+
+			size_t count = begin;
+			for (size_t i = begin + 1; i < end; ++i)
+			{
+				if (skyline[count].y == skyline[i].y)
+					skyline[count].width += skyline[i].width;
+				else
+					skyline[++count] = skyline[i];
+			}
+			skyline.erase(skyline.begin() + count + 1, skyline.begin() + end);
+		}
+
+		bool AtlasGenerator::FindMaxRectsPosition(Rectangle const & r, AtlasDefinition const & atlas_def, glm::ivec2 & position) const
+		{
+			int best_short_side = std::numeric_limits<int>::max();
+			int best_long_side = std::numeric_limits<int>::max();
+
+			// best short side fit
+			for (Rectangle const & free_rectangle : atlas_def.free_rectangles)
+			{
+				if (free_rectangle.width < r.width || free_rectangle.height < r.height)
+					continue;
+
+				int dx = free_rectangle.width - r.width;
+				int dy = free_rectangle.height - r.height;
+				int short_side = std::min(dx, dy);
+				int long_side = std::max(dx, dy);
+
+				if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side))
+				{
+					best_short_side = short_side;
+					best_long_side = long_side;
+					position = glm::ivec2(free_rectangle.x, free_rectangle.y);
+				}
+			}
+			return (best_short_side != std::numeric_limits<int>::max());
+		}
+
+		void AtlasGenerator::InsertMaxRectsRectangle(Rectangle const & r, AtlasDefinition & atlas_def) const
+		{
+			std::vector<Rectangle> & free_rectangles = atlas_def.free_rectangles;
+
+			// split the free rectangles that intersect the new one into (up to) 4 maximal rectangles
+			std::vector<Rectangle> new_rectangles;
+
+			size_t kept_count = 0;
+			for (size_t i = 0; i < free_rectangles.size(); ++i)
+			{
+				Rectangle const f = free_rectangles[i];
+				if (!f.IsIntersecting(r))
+				{
+					free_rectangles[kept_count++] = f;
+					continue;
+				}
+				if (r.x > f.x) // left
+					new_rectangles.push_back({ f.x, f.y, r.x - f.x, f.height });
+				if (r.x + r.width < f.x + f.width) // right
+					new_rectangles.push_back({ r.x + r.width, f.y, f.x + f.width - r.x - r.width, f.height });
+				if (r.y > f.y) // bottom
+					new_rectangles.push_back({ f.x, f.y, f.width, r.y - f.y });
+				if (r.y + r.height < f.y + f.height) // top
+					new_rectangles.push_back({ f.x, r.y + r.height, f.width, f.y + f.height - r.y - r.height });
+			}
+			free_rectangles.resize(kept_count);
+
+			// prune : the unchanged rectangles cannot contain each others. Only tests involving a new rectangle are necessary
+			size_t new_count = 0;
+			for (size_t i = 0; i < new_rectangles.size(); ++i)
+			{
+				Rectangle const & n = new_rectangles[i];
+
+				bool contained = false;
+				for (size_t j = 0; j < new_rectangles.size() && !contained; ++j)
+					if (j != i && n.IsFullyInside(new_rectangles[j]))
+						contained = !(n == new_rectangles[j]) || (j < i); // keep only the first of identical rectangles
+				for (size_t j = 0; j < kept_count && !contained; ++j)
+					contained = n.IsFullyInside(free_rectangles[j]);
+
+				if (!contained)
+					new_rectangles[new_count++] = n;
+			}
+			new_rectangles.resize(new_count);
+
+			auto IsContainedInNewRectangle = [&new_rectangles](Rectangle const & f)
+			{
+				for (Rectangle const & n : new_rectangles)
+					if (f.IsFullyInside(n))
+						return true;
+				return false;
+			};
+			free_rectangles.erase(std::remove_if(free_rectangles.begin(), free_rectangles.end(), IsContainedInNewRectangle), free_rectangles.end());
+			free_rectangles.insert(free_rectangles.end(), new_rectangles.begin(), new_rectangles.end());
 		}
 
 		void AtlasGenerator::InsertBitmapLayoutInAtlas(BitmapLayout & layout, AtlasDefinition & atlas_def, glm::ivec2 const & position)
@@ -674,26 +1446,20 @@ namespace chaos
 			layout.topright_texcoord.x = MathTools::CastAndDiv<float>(layout.x + layout.width, params.atlas_width);
 			layout.topright_texcoord.y = 1.0f - MathTools::CastAndDiv<float>(layout.y, params.atlas_height);
 
-			// erase the point from potential entries
-			auto it = std::find(atlas_def.potential_bottomleft_corners.begin(), atlas_def.potential_bottomleft_corners.end(), position);
-			if (it != atlas_def.potential_bottomleft_corners.end())
-				atlas_def.potential_bottomleft_corners.erase(it);
-
-			// insert 3 new corners as entries (bottom-right / top-left / top-right)
-			int width  = layout.width + 2 * params.atlas_padding;
-			int height = layout.height + 2 * params.atlas_padding;
-
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x + width, position.y);
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x, position.y + height);
-			atlas_def.potential_bottomleft_corners.emplace_back(position.x + width, position.y + height);
-
-			// insert new rectangle to test for collision
+			// the rectangle including the padding
 			Rectangle r;
 			r.x = position.x;
 			r.y = position.y;
-			r.width = width;
-			r.height = height;
-			atlas_def.collision_rectangles.push_back(r);
+			r.width = layout.width + 2 * params.atlas_padding;
+			r.height = layout.height + 2 * params.atlas_padding;
+
+			// update the free space of the page
+			if (params.packing_algorithm == AtlasPackingAlgorithm::SKYLINE)
+				InsertSkylineRectangle(r, atlas_def);
+			else if (params.packing_algorithm == AtlasPackingAlgorithm::MAX_RECTS)
+				InsertMaxRectsRectangle(r, atlas_def);
+			else
+				InsertCornerRectangle(r, atlas_def);
 
 			// compute sum of all surfaces used in this atlas page
 			atlas_def.surface_sum += (unsigned int)
@@ -703,16 +1469,33 @@ namespace chaos
 
 		bool AtlasGenerator::CreateAtlasFromDirectory(FilePathParam const & bitmaps_dir, FilePathParam const & path, bool recursive, AtlasGeneratorParams const & in_params)
 		{
-			// fill the atlas
+			// the result of the previous call (if any)
+			boost::filesystem::path cache_path = path.GetResolvedPath();
+			cache_path.replace_extension("atlas_cache");
+
+			boost::filesystem::path image_directory = cache_path;
+			image_directory.replace_extension("atlas_cache_images");
+
+			AtlasBuildCache build_cache;
+			build_cache.LoadCache(cache_path);
+			build_cache.SetImageDirectory(image_directory);
+
+			// fill the atlas (the images whose source did not change are not decoded nor processed again)
 			AtlasInput input;
+			input.SetBuildCache(&build_cache);
 			FolderInfoInput * folder_info = input.AddFolder("files", 0);
 			folder_info->AddBitmapFilesFromDirectory(bitmaps_dir, recursive);
-			// create the atlas files
+
+			// create the atlas files (only the pages that changed are saved)
 			Atlas          atlas;
 			AtlasGenerator generator;
-			if (generator.ComputeResult(input, atlas, in_params))
-				return atlas.SaveAtlas(path);
-			return false;
+			generator.SetBuildCache(&build_cache);
+			if (!generator.ComputeResult(input, atlas, in_params))
+				return false;
+			if (!atlas.SaveAtlas(path, &build_cache))
+				return false;
+			build_cache.SaveCache(cache_path);
+			return true;
 		}
 
 		// ========================================================================
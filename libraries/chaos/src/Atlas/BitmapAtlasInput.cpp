@@ -193,6 +193,7 @@ namespace chaos
 					result->name = name;
 					result->tag = tag;
 					folders.push_back(std::move(std::unique_ptr<FolderInfoInput>(result)));
+					InvalidateIndices();
 				}
 			}
 			return result;
@@ -292,7 +293,7 @@ namespace chaos
 			// load the face and set pixel size
 			FT_Face face = nullptr;
 
-			Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::NO_ERROR_TRACE); // for direct access to resource directory
+			Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE); // for direct access to resource directory
 			if (buffer == nullptr)
 				Log::Error("FolderInfoInput::AddFontFileWithManifestImpl: fail to load [%s]", path.GetResolvedPath().string().c_str());
 			if (buffer != nullptr)
@@ -391,6 +392,7 @@ namespace chaos
 					info->bitmap_left = glyph.second.bitmap_left; // take the FT_Pixel_Size(...) into consideration
 					info->bitmap_top = glyph.second.bitmap_top;   // take the FT_Pixel_Size(...) into consideration
 					result->elements.push_back(std::move(std::unique_ptr<CharacterInfoInput>(info)));
+					result->InvalidateIndices();
 
 					RegisterResource(bitmap, true);
 				}
@@ -401,6 +403,7 @@ namespace chaos
 				FT_Done_Glyph((FT_Glyph)glyph.second.bitmap_glyph);
 
 			fonts.push_back(std::move(std::unique_ptr<FontInfoInput>(result)));
+			InvalidateIndices();
 
 			return result;
 		}
@@ -414,17 +417,32 @@ namespace chaos
             AddFilesToFolderData add_data(path);
             add_data.SearchEntriesInDirectory();
 
-			// step 1 : the files
+			// step 1 : the files (search the manifests, the images are not loaded yet)
+			std::vector<BitmapFileLoadData> files_load_data;
 			for (boost::filesystem::path const & p : add_data.files)
 			{
 				// skip already handled path
 				if (std::find(add_data.ignore_files.begin(), add_data.ignore_files.end(), p) != add_data.ignore_files.end())
 					continue;
-				// add bitmap
-				AddBitmapFileImpl(p, nullptr, 0, add_data);
+				// prepare bitmap
+				BitmapFileLoadData load_data;
+				if (PrepareBitmapFileImpl(p, nullptr, 0, add_data, load_data))
+					files_load_data.push_back(std::move(load_data));
 			}
 
-			// step 2 : the directories
+			// step 2 : decode and process the images in parallel
+			std::vector<char> loaded(files_load_data.size(), 0); // not vector<bool> : each job writes its own element
+			JobManager::GetInstance()->ParallelFor(files_load_data.size(), [&files_load_data, &loaded](size_t index)
+			{
+				loaded[index] = LoadBitmapFileImpl(files_load_data[index]);
+			});
+
+			// step 3 : add the bitmaps in the order of the files (the result does not depend on the threads)
+			for (size_t i = 0; i < files_load_data.size(); ++i)
+				if (loaded[i])
+					InsertBitmapFileImpl(files_load_data[i]);
+
+			// step 4 : the directories
 			if (recursive)
 			{
 				for (boost::filesystem::path const& p : add_data.directories)
@@ -487,6 +505,16 @@ namespace chaos
         }
 
         BitmapInfoInput* FolderInfoInput::AddBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data)
+        {
+            BitmapFileLoadData load_data;
+            if (!PrepareBitmapFileImpl(path, name, tag, add_data, load_data))
+                return nullptr;
+            if (!LoadBitmapFileImpl(load_data))
+                return nullptr;
+            return InsertBitmapFileImpl(load_data);
+        }
+
+        bool FolderInfoInput::PrepareBitmapFileImpl(FilePathParam const& path, char const* name, TagType tag, AddFilesToFolderData& add_data, BitmapFileLoadData& load_data) const
         {
             // compute a name from the path if necessary
             boost::filesystem::path const& resolved_path = path.GetResolvedPath();
@@ -495,11 +523,10 @@ namespace chaos
             if (FileTools::IsTypedFile(path, "json"))
             {
                 // load the manifest
-                nlohmann::json json_manifest;
-				if (!JSONTools::LoadJSONFile(path, json_manifest))
+				if (!JSONTools::LoadJSONFile(path, load_data.json_manifest))
 				{
 					Log::Error("FolderInfoInput::AddBitmapFileImpl => failed to load json file [%s]", resolved_path.string().c_str());
-					return nullptr;
+					return false;
 				}
 
                 // search whether a related file/directory exists
@@ -512,9 +539,8 @@ namespace chaos
                 {
                     add_data.ignore_directories.push_back(noext_path);
 
-                    std::vector<FIBITMAP*> child_images = LoadManifestImagesFromDirectory(noext_path); // read in that directory all images and considere these as an animation (if several)
-                    if (child_images.size() > 0)
-                        return AddBitmapFileWithManifestImpl(path, name, tag, &json_manifest, &child_images);
+                    load_data.path = resolved_path;
+                    load_data.frames_directory = noext_path; // read in that directory all images and considere these as an animation (if several)
                 }
                 // search whether there is a corresponding file for the manifest
                 else
@@ -528,75 +554,78 @@ namespace chaos
                         if (other_path == noext_path) // other file has same name (without extension)
                         {
                             add_data.ignore_files.push_back(p);
-                            return AddBitmapFileWithManifestImpl(p, name, tag, &json_manifest, nullptr);
+                            load_data.path = p;
+                            break;
                         }
                     }
+                    if (load_data.path.empty())
+                        return false;
                 }
-                return nullptr;
             }
             // normal file
             else
             {
                 // search whether a manifest for the file exists
-                nlohmann::json json_manifest;
-
                 boost::filesystem::path json_path = resolved_path;
                 json_path.replace_extension("json");
-                JSONTools::LoadJSONFile(json_path, json_manifest, LoadFileFlag::NO_ERROR_TRACE);
+                JSONTools::LoadJSONFile(json_path, load_data.json_manifest, LoadFileFlag::NO_ERROR_TRACE);
 
                 // do not individually load the manifest in recursive calls
                 add_data.ignore_files.push_back(json_path);
 
-                return AddBitmapFileWithManifestImpl(path, name, tag, json_manifest.empty() ? nullptr : &json_manifest, nullptr);
+                load_data.path = resolved_path;
             }
-        }
-
-        BitmapInfoInput* FolderInfoInput::AddBitmapFileWithManifestImpl(FilePathParam const& path, char const* name, TagType tag, nlohmann::json const * json_manifest, std::vector<FIBITMAP*>* images)
-        {
-			// compute a name from the path if necessary
-			boost::filesystem::path const & resolved_path = path.GetResolvedPath();
 
 			// test whether there is a grid describing the animation ... even if the grid_info is discarded due to manifest, we want to compute the final name with truncated suffixes
 			std::string animated_name;
-
-			ImageAnimationDescription animation_description;
-			BitmapGridAnimationInfo::ParseFromName(resolved_path.string().c_str(), animation_description.grid_data, &animated_name);
+			BitmapGridAnimationInfo::ParseFromName(load_data.path.string().c_str(), load_data.animation_description.grid_data, &animated_name);
 
 			// search the name if not provided
-			std::string generated_name;
-			if (name == nullptr)
-			{
-				if (!animated_name.empty())
-					generated_name = PathTools::PathToName(animated_name);
-				else
-					generated_name = PathTools::PathToName(resolved_path);
-				name = generated_name.c_str();
-			}
+			if (name != nullptr)
+				load_data.name = name;
+			else if (!animated_name.empty())
+				load_data.name = PathTools::PathToName(animated_name);
+			else
+				load_data.name = PathTools::PathToName(load_data.path);
+			load_data.tag = tag;
+			if (atlas_input != nullptr)
+				load_data.build_cache = atlas_input->GetBuildCache();
 
             // test whether the object already exists
-			if (GetBitmapInfo(name) != nullptr)
+			if (GetBitmapInfo(load_data.name.c_str()) != nullptr)
+				return false;
+			return true;
+        }
+
+        bool FolderInfoInput::LoadBitmapFileImpl(BitmapFileLoadData& load_data)
+        {
+            ImageAnimationDescription & animation_description = load_data.animation_description;
+
+			// the images may have been processed by a previous generation
+			uint64_t source_key = 0;
+			if (load_data.build_cache != nullptr)
 			{
-				ReleaseAllImages(images);
-				return nullptr;
+				source_key = AtlasBuildCache::ComputeSourceKey(load_data);
+				if (source_key != 0 && load_data.build_cache->LoadSourceImages(source_key, load_data.images, animation_description))
+					return true;
 			}
 
             // search if there is a JSON file to describe an animation
             BitmapInfoInputManifest input_manifest;
-            if (json_manifest != nullptr)
-                LoadFromJSON(json_manifest, input_manifest);
+            if (!load_data.json_manifest.empty())
+                LoadFromJSON(&load_data.json_manifest, input_manifest);
 
 			// load all pages for the bitmap
-            std::vector<FIBITMAP*> pages;
-            if (images == nullptr)
-            {
-                pages = ImageTools::LoadMultipleImagesFromFile(path, &animation_description); // extract frame_rate from META DATA
-                images = &pages;
-            }
+            std::vector<FIBITMAP*>& images = load_data.images;
+            if (!load_data.frames_directory.empty())
+                images = LoadManifestImagesFromDirectory(load_data.frames_directory);
+            else
+                images = ImageTools::LoadMultipleImagesFromFile(load_data.path, &animation_description); // extract frame_rate from META DATA
 
 			// no image ?
-			size_t count = images->size();
+			size_t count = images.size();
 			if (count == 0)
-				return nullptr;
+				return false;
 
 			// prefere JSON settings to name encoded values or GIF meta data for frame rate
 			if (input_manifest.anim_duration > 0.0f)
@@ -615,21 +644,36 @@ namespace chaos
 			// not clear what to do (we have both a grid and a per frame animation). Abord
 			if (count > 1 && input_manifest.grid_data.GetFrameCount() > 1)
 			{
-				Log::Error("AddBitmapFileWithManifestImpl[%s] : cannot have multiple images and GRID structure in the same time", resolved_path.string().c_str());
-				ReleaseAllImages(images);
-				return nullptr;
+				Log::Error("AddBitmapFileWithManifestImpl[%s] : cannot have multiple images and GRID structure in the same time", load_data.path.string().c_str());
+				ReleaseAllImages(&images);
+				return false;
 			}
 
 			// apply filters on image => the number of images must be the same or error
-			if (!ApplyProcessors(*images, input_manifest.image_processors, animation_description.grid_data))
+			if (!ApplyProcessors(images, input_manifest.image_processors, animation_description.grid_data))
+				return false;
+
+			// keep the result for the next generations
+			if (source_key != 0)
+				load_data.build_cache->SaveSourceImages(source_key, images, animation_description);
+			return true;
+		}
+
+		BitmapInfoInput* FolderInfoInput::InsertBitmapFileImpl(BitmapFileLoadData& load_data)
+		{
+            // test whether the object already exists (some files may have the same name)
+			if (GetBitmapInfo(load_data.name.c_str()) != nullptr)
+			{
+				ReleaseAllImages(&load_data.images);
 				return nullptr;
+			}
 
             // register resources for destructions
-			for (size_t i = 0; i < count; ++i)
-				RegisterResource(images->operator[](i), true);
+			for (FIBITMAP* image : load_data.images)
+				RegisterResource(image, true);
 
 			// create the bitmap
-			return AddBitmapImpl(*images, name, tag, &animation_description); // in case of failure, the images have already been registered for destruction
+			return AddBitmapImpl(load_data.images, load_data.name.c_str(), load_data.tag, &load_data.animation_description); // in case of failure, the images have already been registered for destruction
 		}
 
 		BitmapInfoInput* FolderInfoInput::AddBitmap(FilePathParam const& path, char const* name, TagType tag)
@@ -691,6 +735,7 @@ namespace chaos
 
 			// insert result into the folder
 			bitmaps.push_back(std::move(std::unique_ptr<BitmapInfoInput>(result))); // move for std::string copy
+			InvalidateIndices();
 			result = bitmaps.back().get();
 
 			// insert child animation frames
@@ -717,6 +762,7 @@ namespace chaos
 							child_frame->atlas_input = atlas_input;
 							child_frame->description = ImageTools::GetImageDescription(pages[i]);
 							bitmaps.push_back(std::move(std::unique_ptr<BitmapInfoInput>(child_frame)));
+							InvalidateIndices();
 							// insert the child frame inside the animation block
 							animation_info->child_frames.push_back(child_frame);
 						}
@@ -177,11 +177,13 @@ namespace chaos
 
 	bool Application::InitializeStandardLibraries()
 	{
+		JobManager::GetInstance()->StartWorkers();
 		return true;
 	}
 
 	void Application::FinalizeStandardLibraries()
 	{
+		JobManager::GetInstance()->StopWorkers();
 	}
 
 	bool Application::InitializeManagers()
@@ -110,9 +110,10 @@ namespace chaos
 		for (size_t i = 0; i < child_count; ++i)
 			children_clocks[i]->parent_clock = nullptr;
 		// same thing with events
-		size_t event_count = pending_events.size();
-		for (size_t i = 0; i < event_count; ++i)
-			pending_events[i]->clock = nullptr;
+		for (shared_ptr<ClockEvent> const & clock_event : active_events)
+			clock_event->clock = nullptr;
+		for (shared_ptr<ClockEvent> const & clock_event : dormant_events)
+			clock_event->clock = nullptr;
 	}
 
 	bool Clock::IsDescendantClock(Clock const * child_clock) const
@@ -253,19 +254,20 @@ namespace chaos
 	{
 		assert(parent_clock == nullptr);
 
-		ClockEventTickSet event_tick_set;
+		// XXX : the buffer is taken from the clock so that a TickClock(...) inside an event is still possible
+		ClockEventTickSet event_tick_set = std::move(tick_registrations);
+		event_tick_set.clear();
 
-		// updates the clocks and collect the events (sorted)
+		// updates the clocks and collect the events
 		bool result = TickClockImpl(delta_time, 1.0, event_tick_set);
-		// tick the events
-		while (event_tick_set.size() > 0)
-		{
-			auto it = event_tick_set.begin();
-
-			ClockEventTickRegistration registered_event = *it;
-			event_tick_set.erase(it);
+		// tick the events (sorted)
+		std::stable_sort(event_tick_set.begin(), event_tick_set.end(), ClockEventTickSort());
+		for (ClockEventTickRegistration & registered_event : event_tick_set)
 			TriggerClockEvent(registered_event);
-		}
+
+		// give the buffer back (without references on the events)
+		event_tick_set.clear();
+		tick_registrations = std::move(event_tick_set);
 		return result;
 	}
 
@@ -282,13 +284,23 @@ namespace chaos
 
 		if (tick_events)
 		{
-			for (size_t i = 0; i < pending_events.size(); ++i)
+			// the events whose start time is reached may be ticked
+			WakeDormantEvents(time2);
+
+			for (size_t i = 0; i < active_events.size(); ++i)
 			{
-				ClockEventInfo const & event_info = pending_events[i]->GetEventInfo();
+				ClockEventInfo const & event_info = active_events[i]->GetEventInfo();
 
-				if (event_info.IsTooLateFor(time1))
+				if (event_info.start_time > time2) // not started yet (a repetition for example) : nothing to do until then
+				{
+					shared_ptr<ClockEvent> clock_event = active_events[i]; // XXX : keep a reference while the event is moved
+					DetachEvent(clock_event.get()); // XXX : this is a "RemoveReplace" so --i
+					InsertEvent(clock_event.get());
+					--i;
+				}
+				else if (event_info.IsTooLateFor(time1))
 				{
-					shared_ptr<ClockEvent> clock_event = pending_events[i]; // XXX : important to keep a reference after RemoveFromClock(...)
+					shared_ptr<ClockEvent> clock_event = active_events[i]; // XXX : important to keep a reference after RemoveFromClock(...)
 					clock_event->RemoveFromClock(); // XXX : we know RemoveFromClock = "RemoveReplace" so --i
 					--i;
 				}
@@ -298,7 +310,7 @@ namespace chaos
 					if (execution_info.IsValid())
 					{
 						ClockEventTickRegistration registration;
-						registration.clock_event = pending_events[i];
+						registration.clock_event = active_events[i];
 						registration.time_slice = execution_info.time_slice;
 						registration.execution_range = execution_info.execution_range;
 						registration.tick_range = execution_info.tick_range;
@@ -308,7 +320,7 @@ namespace chaos
 						else
 							registration.abs_time_to_start = (registration.tick_range.first - time1) * cumulated_factor;
 
-						event_tick_set.insert(registration);
+						event_tick_set.push_back(std::move(registration));
 					}
 				}
 			}
@@ -379,11 +391,105 @@ namespace chaos
 		clock_event->event_info = event_info;
 		clock_event->tick_count = 0;
 		clock_event->execution_count = 0;
-		pending_events.push_back(clock_event);
+		InsertEvent(clock_event);
 
 		return true;
 	}
 
+	void Clock::InsertEvent(ClockEvent * clock_event)
+	{
+		assert(clock_event != nullptr);
+		assert(clock_event->clock == this);
+
+		if (clock_event->GetEventInfo().start_time > clock_time)
+		{
+			clock_event->dormant = true;
+			clock_event->clock_index = dormant_events.size();
+			dormant_events.push_back(clock_event);
+			SiftDormantEventUp(clock_event->clock_index);
+		}
+		else
+		{
+			clock_event->dormant = false;
+			clock_event->clock_index = active_events.size();
+			active_events.push_back(clock_event);
+		}
+	}
+
+	void Clock::DetachEvent(ClockEvent * clock_event)
+	{
+		assert(clock_event != nullptr);
+		assert(clock_event->clock == this);
+
+		size_t index = clock_event->clock_index;
+
+		std::vector<shared_ptr<ClockEvent>> & events = (clock_event->dormant) ? dormant_events : active_events;
+		assert(index < events.size() && events[index].get() == clock_event);
+
+		// remove swap (the caller must keep a reference on the event)
+		if (index != events.size() - 1)
+		{
+			std::swap(events[index], events.back());
+			events[index]->clock_index = index;
+		}
+		events.pop_back();
+
+		// the element that has been moved may break the heap property
+		if (clock_event->dormant && index < events.size())
+		{
+			ClockEvent * moved_event = events[index].get();
+			SiftDormantEventUp(index);
+			SiftDormantEventDown(moved_event->clock_index);
+		}
+		clock_event->dormant = false;
+	}
+
+	void Clock::WakeDormantEvents(double time)
+	{
+		while (dormant_events.size() > 0 && dormant_events[0]->GetEventInfo().start_time <= time)
+		{
+			shared_ptr<ClockEvent> clock_event = dormant_events[0]; // keep a reference
+			DetachEvent(clock_event.get());
+			clock_event->clock_index = active_events.size();
+			active_events.push_back(std::move(clock_event));
+		}
+	}
+
+	void Clock::SiftDormantEventUp(size_t index)
+	{
+		while (index > 0)
+		{
+			size_t parent = (index - 1) / 2;
+			if (dormant_events[parent]->GetEventInfo().start_time <= dormant_events[index]->GetEventInfo().start_time)
+				break;
+			std::swap(dormant_events[parent], dormant_events[index]);
+			dormant_events[parent]->clock_index = parent;
+			dormant_events[index]->clock_index = index;
+			index = parent;
+		}
+	}
+
+	void Clock::SiftDormantEventDown(size_t index)
+	{
+		size_t count = dormant_events.size();
+		while (true)
+		{
+			size_t smallest = index;
+			size_t left = 2 * index + 1;
+			size_t right = left + 1;
+			if (left < count && dormant_events[left]->GetEventInfo().start_time < dormant_events[smallest]->GetEventInfo().start_time)
+				smallest = left;
+			if (right < count && dormant_events[right]->GetEventInfo().start_time < dormant_events[smallest]->GetEventInfo().start_time)
+				smallest = right;
+			if (smallest == index)
+				break;
+			std::swap(dormant_events[smallest], dormant_events[index]);
+			dormant_events[smallest]->clock_index = smallest;
+			dormant_events[index]->clock_index = index;
+			index = smallest;
+		}
+	}
+
 	void Clock::RemoveAllChildClocks()
 	{
 		while (children_clocks.size() > 0)
@@ -395,9 +501,14 @@ namespace chaos
 
 	void Clock::RemoveAllPendingEvents()
 	{
-		while (pending_events.size() > 0)
+		while (active_events.size() > 0)
+		{
+			shared_ptr<ClockEvent> clock_event = active_events[active_events.size() - 1];
+			clock_event->RemoveFromClock();
+		}
+		while (dormant_events.size() > 0)
 		{
-			shared_ptr<ClockEvent> clock_event = pending_events[pending_events.size() - 1];
+			shared_ptr<ClockEvent> clock_event = dormant_events[dormant_events.size() - 1];
 			clock_event->RemoveFromClock();
 		}
 	}
@@ -407,23 +518,14 @@ namespace chaos
 		Clock * tmp = clock; // keep a trace of parent
 		if (tmp != nullptr)
 		{
-			size_t count = tmp->pending_events.size();
-			for (size_t i = 0; i < count; ++i)
-			{
-				if (tmp->pending_events[i].get() == this)
-				{
-					AddReference(); // because, we want to pop back the event, then call OnEventRemovedFromClock(...)
+			AddReference(); // because, we want to pop back the event, then call OnEventRemovedFromClock(...)
 
-					if (i != count - 1)
-						std::swap(tmp->pending_events[i], tmp->pending_events.back());
-					clock = nullptr;
-					tmp->pending_events.pop_back();
+			tmp->DetachEvent(this);
+			clock = nullptr;
 
-					OnEventRemovedFromClock();
-					SubReference();
-					return true;
-				}
-			}
+			OnEventRemovedFromClock();
+			SubReference();
+			return true;
 		}
 		return false;
 	}
@@ -92,6 +92,73 @@ namespace chaos
 			return result;
 		}
 
+		/**
+		* MappedFileBufferPolicy : the policy for a buffer whose data is a read-only view of a file
+		*/
+
+		class MappedFileBufferPolicy : public BufferPolicyBase
+		{
+		public:
+
+			/** constructor */
+			MappedFileBufferPolicy(boost::interprocess::mapped_region&& in_region) :
+				region(std::move(in_region)),
+				reference_count(1) {}
+
+			/** generate the buffer (empty on failure) */
+			static Buffer<char const> NewBuffer(boost::filesystem::path const& resolved_path)
+			{
+				try
+				{
+					boost::interprocess::file_mapping mapping(resolved_path.string().c_str(), boost::interprocess::read_only);
+					boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only); // the region stays valid once the mapping is closed
+					if (region.get_size() == 0)
+						return {};
+
+					MappedFileBufferPolicy* policy = new MappedFileBufferPolicy(std::move(region));
+					Buffer<char const> result((char const*)policy->region.get_address(), policy->region.get_size());
+					result.SetPolicy(policy);
+					return result;
+				}
+				catch (boost::interprocess::interprocess_exception const&) // empty file, missing rights ...
+				{
+				}
+				return {};
+			}
+
+		protected:
+
+			/** copy the buffer */
+			virtual void CopyBuffer(BufferBase* dst, BufferBase const* src) override
+			{
+				assert(dst != nullptr);
+				assert(src != nullptr);
+				assert(src->GetPolicy() == this);
+
+				Buffer<char const>* d = (Buffer<char const>*)dst;
+				Buffer<char const> const* s = (Buffer<char const> const*)src;
+
+				d->data = s->data;
+				d->bufsize = s->bufsize;
+				d->SetPolicy(this);
+				++reference_count;
+			}
+
+			/** destroy the buffer */
+			virtual void DestroyBuffer(BufferBase* buf) override
+			{
+				if (--reference_count == 0)
+					delete(this); // unmap the file
+			}
+
+		protected:
+
+			/** the mapped view of the file */
+			boost::interprocess::mapped_region region;
+			/** count the reference on the buffer */
+			boost::atomic<int> reference_count;
+		};
+
 #if _DEBUG // File Redirection
 
 		static boost::filesystem::path BuildRedirectedPath(boost::filesystem::path const& p, boost::filesystem::path const & build_path, boost::filesystem::path const& src_path)
@@ -205,6 +272,8 @@ namespace chaos
 
 		Buffer<char> LoadFile(FilePathParam const& path, LoadFileFlag flags)
 		{
+			CHAOS_PROFILE_ZONE("FileTools::LoadFile");
+
 			Buffer<char> result;
 			WithFile(path, [&result, &path, flags](boost::filesystem::path const&p)
 			{
@@ -225,6 +294,34 @@ namespace chaos
 			return result;
 		}
 
+		Buffer<char const> MapFile(FilePathParam const& path, LoadFileFlag flags)
+		{
+			CHAOS_PROFILE_ZONE("FileTools::MapFile");
+
+			Buffer<char const> result;
+			WithFile(path, [&result, &path, flags](boost::filesystem::path const&p)
+			{
+				// a mapping cannot add the null terminator
+				if (!HasAnyFlags(flags, LoadFileFlag::ASCII))
+					result = MappedFileBufferPolicy::NewBuffer(p);
+				if (result == nullptr)
+					result = DoLoadFile(p, flags);
+#if _DEBUG
+				if (result && GlobalVariables::ShowLoadedFile.Get())
+				{
+					Log::Message("MapFile [%s] -> [%s]    size = [%d]", path.GetResolvedPath().string().c_str(), p.string().c_str(), result.bufsize);
+				}
+#endif
+				return result; // convert to bool
+			});
+
+			if (result == nullptr && int(flags & LoadFileFlag::NO_ERROR_TRACE) == 0)
+			{
+				Log::Error("MapFile fails [%s]", path.GetResolvedPath().string().c_str());
+			}
+			return result;
+		}
+
 		bool CreateTemporaryDirectory(char const* pattern, boost::filesystem::path& result)
 		{
 			boost::filesystem::path temp_path = boost::filesystem::temp_directory_path();
@@ -30,95 +30,105 @@ namespace chaos
 			ImGui::TableSetupColumn("Action", 0);
 			ImGui::TableHeadersRow();
 
-			std::vector<LogLine> const& lines = logger->GetLines();
-			for (size_t i = 0; i < lines.size(); ++i)
+			// the lines are visited under the lock of the logger (no copy)
+			//   identical consecutive lines are displayed once (the first one of the group)
+			LogLine const* group_line = nullptr;
+			size_t group_count = 0;
+			size_t index = 0;
+			logger->ForEachLine([this, &group_line, &group_count, &index](LogLine const& line)
 			{
-				LogLine const& line = lines[i];
-
-				// group messages
-				size_t group_count = 1;
-				if (group_identical_lines)
-				{
-					while (i + 1 < lines.size() && line.IsComparable(lines[i + 1]))
-					{
-						++i;
-						++group_count;
-					}
-				}
-
-				// filter out by domain
-				auto it = domain_visibilities.find(line.domain);
-				if (it != domain_visibilities.end())
-					if (!it->second)
-						continue;
-
-				// search color and filter out by type
-				ImVec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
-				if (line.severity == LogSeverity::Message)
+				if (group_line != nullptr && group_identical_lines && group_line->IsComparable(line))
 				{
-					if (!show_messages)
-						continue;
-					color = { 1.0f, 1.0f, 1.0f, 1.0f };
+					++group_count;
 				}
-				else if (line.severity == LogSeverity::Warning)
+				else
 				{
-					if (!show_warnings)
-						continue;
-					color = { 1.0f, 0.64f, 0.0f, 1.0f };
-				}
-				else if (line.severity == LogSeverity::Error)
-				{
-					if (!show_errors)
-						continue;
-					color = { 1.0f, 0.0f, 0.0f, 1.0f };
+					if (group_line != nullptr)
+						DrawLine(*group_line, group_count, index);
+					group_line = &line;
+					group_count = 1;
 				}
+				++index;
+			});
+			if (group_line != nullptr)
+				DrawLine(*group_line, group_count, index);
+			ImGui::EndTable();
+		}
+	}
 
-				// filter by content
-				if (!filter.PassFilter(line.content.c_str()))
-					continue;
-
-				// time
-				ImGui::PushID(int(i * COLUMN_COUNT + 0));
-				ImGui::TableNextColumn();
-				ImGui::TextColored(color, "%s", StringTools::TimeToString(line.time, TimeToStringFormatType::FULL).c_str());
-				ImGui::PopID();
-
-				// type
-				ImGui::PushID(int(i * COLUMN_COUNT + 1));
-				ImGui::TableNextColumn();
-				ImGui::TextColored(color, EnumToString(line.severity));
-				ImGui::PopID();
-
-				// domain
-				ImGui::PushID(int(i * COLUMN_COUNT + 2));
-				ImGui::TableNextColumn();
-				ImGui::TextColored(color, "%s", line.domain);
-				ImGui::PopID();
-
-				// group count
-				ImGui::PushID(int(i * COLUMN_COUNT + 3));
-				ImGui::TableNextColumn();
-				ImGui::TextColored(color, "%d", group_count);
-				ImGui::PopID();
-
-				// message
-				ImGui::PushID(int(i * COLUMN_COUNT + 4));
-				ImGui::TableNextColumn();
-				ImGui::TextColored(color, "%s", line.content.c_str());
-				ImGui::PopID();
-
-				// actions
-				ImGui::PushID(int(i * COLUMN_COUNT + 5));
-				ImGui::TableNextColumn();
-				if (ImGui::Button("Clipboard"))
-				{
-					ImGui::GetIO().SetClipboardTextFn(nullptr, line.ToString().c_str());
-				}
-				ImGui::PopID();
+	void ImGuiLogObject::DrawLine(LogLine const& line, size_t group_count, size_t index)
+	{
+		size_t constexpr COLUMN_COUNT = 6;
 
-			}
-			ImGui::EndTable();
+		// filter out by domain
+		auto it = domain_visibilities.find(line.domain);
+		if (it != domain_visibilities.end())
+			if (!it->second)
+				return;
+
+		// search color and filter out by type
+		ImVec4 color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		if (line.severity == LogSeverity::Message)
+		{
+			if (!show_messages)
+				return;
+			color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		}
+		else if (line.severity == LogSeverity::Warning)
+		{
+			if (!show_warnings)
+				return;
+			color = { 1.0f, 0.64f, 0.0f, 1.0f };
+		}
+		else if (line.severity == LogSeverity::Error)
+		{
+			if (!show_errors)
+				return;
+			color = { 1.0f, 0.0f, 0.0f, 1.0f };
+		}
+
+		// filter by content
+		if (!filter.PassFilter(line.content.c_str()))
+			return;
+
+		// time
+		ImGui::PushID(int(index * COLUMN_COUNT + 0));
+		ImGui::TableNextColumn();
+		ImGui::TextColored(color, "%s", StringTools::TimeToString(line.time, TimeToStringFormatType::FULL).c_str());
+		ImGui::PopID();
+
+		// type
+		ImGui::PushID(int(index * COLUMN_COUNT + 1));
+		ImGui::TableNextColumn();
+		ImGui::TextColored(color, EnumToString(line.severity));
+		ImGui::PopID();
+
+		// domain
+		ImGui::PushID(int(index * COLUMN_COUNT + 2));
+		ImGui::TableNextColumn();
+		ImGui::TextColored(color, "%s", line.domain);
+		ImGui::PopID();
+
+		// group count
+		ImGui::PushID(int(index * COLUMN_COUNT + 3));
+		ImGui::TableNextColumn();
+		ImGui::TextColored(color, "%d", group_count);
+		ImGui::PopID();
+
+		// message
+		ImGui::PushID(int(index * COLUMN_COUNT + 4));
+		ImGui::TableNextColumn();
+		ImGui::TextColored(color, "%s", line.content.c_str());
+		ImGui::PopID();
+
+		// actions
+		ImGui::PushID(int(index * COLUMN_COUNT + 5));
+		ImGui::TableNextColumn();
+		if (ImGui::Button("Clipboard"))
+		{
+			ImGui::GetIO().SetClipboardTextFn(nullptr, line.ToString().c_str());
 		}
+		ImGui::PopID();
 	}
 
 	void ImGuiLogObject::OnDrawImGuiMenu(BeginImGuiMenuFunc begin_menu_func)
@@ -0,0 +1,88 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	void ImGuiProfilerObject::OnDrawImGuiContent()
+	{
+		Profiler* profiler = Profiler::GetInstance();
+
+		if (!Profiler::IsEnabled())
+		{
+			ImGui::Text("the profiler is disabled");
+			return;
+		}
+
+		std::vector<ProfilerZoneStatistics> statistics = profiler->GetZoneStatistics();
+		std::ranges::sort(statistics, [](ProfilerZoneStatistics const& src1, ProfilerZoneStatistics const& src2)
+		{
+			return src1.average_frame_duration > src2.average_frame_duration;
+		});
+
+		size_t constexpr COLUMN_COUNT = 6;
+
+		if (ImGui::BeginTable("##zones", COLUMN_COUNT, ImGuiTableFlags_Resizable | ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_BordersInnerV))
+		{
+			ImGui::TableSetupColumn("Zone", 0);
+			ImGui::TableSetupColumn("Calls", 0);
+			ImGui::TableSetupColumn("Frame (ms)", 0);
+			ImGui::TableSetupColumn("Average (ms)", 0);
+			ImGui::TableSetupColumn("Max call (ms)", 0);
+			ImGui::TableSetupColumn("Total calls", 0);
+			ImGui::TableHeadersRow();
+
+			for (ProfilerZoneStatistics const& zone : statistics)
+			{
+				if (!filter.PassFilter(zone.name))
+					continue;
+
+				ImGui::TableNextColumn(); ImGui::Text("%s", zone.name);
+				ImGui::TableNextColumn(); ImGui::Text("%d", int(zone.frame_call_count));
+				ImGui::TableNextColumn(); ImGui::Text("%0.3f", zone.frame_duration);
+				ImGui::TableNextColumn(); ImGui::Text("%0.3f", zone.average_frame_duration);
+				ImGui::TableNextColumn(); ImGui::Text("%0.3f", zone.max_call_duration);
+				ImGui::TableNextColumn(); ImGui::Text("%d", int(zone.total_call_count));
+			}
+			ImGui::EndTable();
+		}
+
+		if (size_t lost_event_count = profiler->GetLostEventCount())
+			ImGui::TextColored({ 1.0f, 0.64f, 0.0f, 1.0f }, "%d events lost (buffers too small)", int(lost_event_count));
+	}
+
+	void ImGuiProfilerObject::OnDrawImGuiMenu(BeginImGuiMenuFunc begin_menu_func)
+	{
+		begin_menu_func([this]()
+		{
+			if (ImGui::BeginMenu("Actions"))
+			{
+				Profiler* profiler = Profiler::GetInstance();
+
+				bool enabled = Profiler::IsEnabled();
+				if (ImGui::Checkbox("enabled", &enabled))
+					profiler->SetEnabled(enabled);
+				if (ImGui::MenuItem("Clear"))
+					profiler->Clear();
+				if (ImGui::MenuItem("Save Chrome trace"))
+				{
+					if (Application* application = Application::GetInstance())
+					{
+						boost::filesystem::path path = application->GetUserLocalTempPath() / "profiler_trace.json";
+						if (profiler->SaveChromeTrace(path))
+							Log::Message("Profiler trace saved: %s", path.string().c_str());
+						else
+							Log::Error("ImGuiProfilerObject::OnDrawImGuiMenu(...): fails to save %s", path.string().c_str());
+					}
+				}
+				ImGui::EndMenu();
+			}
+			// filter
+			if (ImGui::BeginMenu("Filter"))
+			{
+				filter.Draw();
+				ImGui::EndMenu();
+			}
+		});
+	}
+
+}; // namespace chaos
\ No newline at end of file
@@ -3,20 +3,172 @@
 
 namespace chaos
 {
+	/** the version of the cache files (to be increased whenever the format or the substitution rules change) */
+	static constexpr int JSON_CACHE_VERSION = 3;
+	/** the files whose content is hashed to detect modifications (the larger ones only rely on their write time and their size) */
+	static constexpr uint64_t MAX_HASHED_DEPENDENCY_SIZE = 1024 * 1024;
+
+	/** FNV-1a hash of a buffer (std::hash is not guaranteed to be stable across builds and the values are persisted) */
+	static uint64_t HashBytes(void const * data, size_t size, uint64_t hash = 14695981039346656037ULL)
+	{
+		unsigned char const * bytes = (unsigned char const *)data;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
 	bool JSONRecursiveLoader::LoadJSONFile(FilePathParam const & path, nlohmann::json & result, LoadFileFlag flag)
 	{
 		flag &= ~LoadFileFlag::RECURSIVE;
+		dependencies.clear();
+
+		// use the compiled version of the file whenever possible
+		boost::filesystem::path resolved_path = path.GetResolvedPath();
+		boost::filesystem::path cache_path = GetCachePath(resolved_path);
+		if (!cache_path.empty() && LoadFromCache(resolved_path, cache_path, result))
+			return true;
+
 		ComputeSubstitutionChain(path, flag);
-		return FinalizeSubstitutions(result);
+		if (!FinalizeSubstitutions(result))
+			return false;
+
+		if (!cache_path.empty())
+			SaveIntoCache(resolved_path, cache_path, result);
+		return true;
 	}
 
 	bool JSONRecursiveLoader::ParseJSONFile(char const * buffer, boost::filesystem::path const & config_path, nlohmann::json & result, LoadFileFlag flag)
 	{
 		flag &= ~LoadFileFlag::RECURSIVE;
+		dependencies.clear();
 		ComputeSubstitutionChain(buffer, config_path, flag);
 		return FinalizeSubstitutions(result);
 	}
 
+	JSONRecursiveLoader::DependencyEntry JSONRecursiveLoader::GetDependencyEntry(boost::filesystem::path const & path)
+	{
+		DependencyEntry result;
+		result.path = path;
+
+		boost::system::error_code error;
+		std::time_t write_time = boost::filesystem::last_write_time(path, error);
+		if (!error)
+		{
+			result.write_time = int64_t(write_time);
+			boost::uintmax_t file_size = boost::filesystem::file_size(path, error);
+			if (!error)
+			{
+				result.file_size = uint64_t(file_size);
+				// XXX : the write time is in seconds. Hash the content so that two modifications within the same second are detected
+				if (result.file_size <= MAX_HASHED_DEPENDENCY_SIZE)
+					if (Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE))
+						result.content_hash = HashBytes(buffer.data, buffer.bufsize);
+			}
+		}
+		return result;
+	}
+
+	boost::filesystem::path JSONRecursiveLoader::GetCachePath(boost::filesystem::path const & path)
+	{
+		Application const * application = Application::GetInstance();
+		if (application == nullptr || application->GetUserLocalTempPath().empty())
+			return {};
+		if (application->HasCommandLineFlag("-NoJSONCache"))
+			return {};
+		// one cache file per source file (the path is checked when the cache is read, so collisions are not an issue)
+		std::string path_string = path.string();
+		uint64_t path_hash = HashBytes(path_string.c_str(), path_string.size());
+		return application->GetUserLocalTempPath() / "json_cache" / StringTools::Printf("%016llx.cbor", (unsigned long long)path_hash);
+	}
+
+	bool JSONRecursiveLoader::LoadFromCache(boost::filesystem::path const & path, boost::filesystem::path const & cache_path, nlohmann::json & result) const
+	{
+		Buffer<char const> buffer = FileTools::MapFile(cache_path, LoadFileFlag::NO_ERROR_TRACE);
+		if (buffer == nullptr)
+			return false;
+
+		nlohmann::json cache = nlohmann::json::from_cbor(buffer.data, buffer.data + buffer.bufsize, true, false); // no exception
+		if (cache.is_discarded() || !cache.is_object())
+			return false;
+
+		// check whether the cache corresponds to the file
+		nlohmann::json::iterator version_it = cache.find("version");
+		if (version_it == cache.end() || !version_it->is_number_integer() || version_it->get<int>() != JSON_CACHE_VERSION)
+			return false;
+
+		nlohmann::json::iterator path_it = cache.find("path");
+		if (path_it == cache.end() || !path_it->is_string() || path_it->get<std::string>() != path.string())
+			return false;
+
+		// check whether some files implied have changed
+		nlohmann::json::iterator dependencies_it = cache.find("dependencies");
+		if (dependencies_it == cache.end() || !dependencies_it->is_array())
+			return false;
+
+		for (nlohmann::json const & dependency : *dependencies_it)
+		{
+			if (!dependency.is_array() || dependency.size() != 4 || !dependency[0].is_string() || !dependency[1].is_number_integer() || !dependency[2].is_number_integer() || !dependency[3].is_number_integer())
+				return false;
+
+			DependencyEntry current = GetDependencyEntry(dependency[0].get<std::string>());
+			if (current.write_time != dependency[1].get<int64_t>() || current.file_size != dependency[2].get<uint64_t>() || current.content_hash != dependency[3].get<uint64_t>())
+				return false;
+		}
+
+		nlohmann::json::iterator json_it = cache.find("json");
+		if (json_it == cache.end())
+			return false;
+		result = std::move(*json_it);
+		return true;
+	}
+
+	bool JSONRecursiveLoader::SaveIntoCache(boost::filesystem::path const & path, boost::filesystem::path const & cache_path, nlohmann::json const & json) const
+	{
+		nlohmann::json cache = nlohmann::json::object();
+		cache["version"] = JSON_CACHE_VERSION;
+		cache["path"] = path.string();
+
+		nlohmann::json dependencies_json = nlohmann::json::array();
+		for (DependencyEntry const & dependency : dependencies)
+			dependencies_json.push_back({ dependency.path.string(), dependency.write_time, dependency.file_size, dependency.content_hash });
+		cache["dependencies"] = std::move(dependencies_json);
+		cache["json"] = json;
+
+		std::vector<uint8_t> data = nlohmann::json::to_cbor(cache);
+
+		boost::system::error_code error;
+		boost::filesystem::create_directories(cache_path.parent_path(), error);
+		if (error)
+			return false;
+
+		// XXX : the same file may be loaded by several threads at once. Write a temporary file and rename it so that a cache is never read while partially written
+		boost::filesystem::path temp_path = boost::filesystem::unique_path(cache_path.string() + ".%%%%-%%%%", error);
+		if (error)
+			return false;
+		{
+			std::ofstream stream(temp_path.c_str(), std::ios::binary);
+			if (!stream)
+				return false;
+			stream.write((char const *)data.data(), std::streamsize(data.size()));
+			if (!stream)
+			{
+				stream.close();
+				boost::filesystem::remove(temp_path, error);
+				return false;
+			}
+		}
+		boost::filesystem::rename(temp_path, cache_path, error);
+		if (error)
+		{
+			boost::filesystem::remove(temp_path, error);
+			return false;
+		}
+		return true;
+	}
+
 	bool JSONRecursiveLoader::FinalizeSubstitutions(nlohmann::json & result)
 	{
 		if (entries.size() > 0)
@@ -169,6 +321,9 @@ namespace chaos
 
 	JSONRecursiveLoader::LoaderEntry * JSONRecursiveLoader::CreateEntry(FilePathParam const & path, LoadFileFlag flag)
 	{
+		// the state of the file is read before its content so that a later modification is always detected
+		dependencies.push_back(GetDependencyEntry(path.GetResolvedPath()));
+
 		nlohmann::json new_json;
 		if (!JSONTools::LoadJSONFile(path, new_json, flag))
 			return nullptr;
@@ -305,6 +305,20 @@ namespace chaos
 			return false;
 		}
 
+		bool Parse(char const* buffer, size_t size, nlohmann::json& result)
+		{
+			assert(buffer != nullptr || size == 0);
+			try
+			{
+				result = nlohmann::json::parse(buffer, buffer + size);
+				return true;
+			}
+			catch (...)
+			{
+			}
+			return false;
+		}
+
 		bool ParseRecursive(char const* buffer, boost::filesystem::path const& config_path, nlohmann::json& result, LoadFileFlag flag)
 		{
 			assert(buffer != nullptr);
@@ -321,7 +335,7 @@ namespace chaos
 			}
 			else
 			{
-				Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::ASCII | LoadFileFlag::NO_ERROR_TRACE);
+				Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE);
 				if (buffer == nullptr)
 				{
 					if (int(flag & LoadFileFlag::NO_ERROR_TRACE) == 0)
@@ -330,7 +344,7 @@ namespace chaos
 					}
 					return false;
 				}
-				return Parse(buffer.data, result);
+				return Parse(buffer.data, buffer.bufsize, result);
 			}
 		}
 
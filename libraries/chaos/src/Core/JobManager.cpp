@@ -0,0 +1,100 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	JobManager::~JobManager()
+	{
+		StopWorkers();
+	}
+
+	void JobManager::StartWorkers(std::optional<size_t> count)
+	{
+		StopWorkers();
+
+		size_t worker_count = count.value_or(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+
+		boost::lock_guard<boost::mutex> lock(mutex);
+		stop_workers = false;
+		for (size_t i = 0; i < worker_count; ++i)
+			workers.emplace_back([this]() { WorkerLoop(); });
+	}
+
+	void JobManager::StopWorkers()
+	{
+		std::vector<std::thread> stopped_workers;
+		{
+			boost::lock_guard<boost::mutex> lock(mutex);
+			stop_workers = true;
+			stopped_workers = std::move(workers);
+			workers.clear();
+		}
+		condition.notify_all();
+		for (std::thread& worker : stopped_workers)
+			worker.join();
+		// execute the jobs that may have been pushed while stopping
+		while (ExecutePendingJob());
+	}
+
+	size_t JobManager::GetWorkerCount() const
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+		return workers.size();
+	}
+
+	void JobManager::PushJob(std::function<void()> job, uint64_t group)
+	{
+		if (!job)
+			return;
+		{
+			boost::lock_guard<boost::mutex> lock(mutex);
+			if (workers.size() > 0)
+			{
+				pending_jobs.push_back({ std::move(job), group });
+				condition.notify_one();
+				return;
+			}
+		}
+		job(); // no worker
+	}
+
+	uint64_t JobManager::NewJobGroup()
+	{
+		return last_job_group.fetch_add(1, boost::memory_order_relaxed) + 1;
+	}
+
+	bool JobManager::ExecutePendingJob(uint64_t group)
+	{
+		std::function<void()> job;
+		{
+			boost::lock_guard<boost::mutex> lock(mutex);
+			auto it = pending_jobs.begin();
+			if (group != 0)
+				it = std::find_if(pending_jobs.begin(), pending_jobs.end(), [group](PendingJob const& pending_job) { return pending_job.group == group; });
+			if (it == pending_jobs.end())
+				return false;
+			job = std::move(it->job);
+			pending_jobs.erase(it);
+		}
+		job();
+		return true;
+	}
+
+	void JobManager::WorkerLoop()
+	{
+		while (true)
+		{
+			std::function<void()> job;
+			{
+				boost::unique_lock<boost::mutex> lock(mutex);
+				condition.wait(lock, [this]() { return stop_workers || pending_jobs.size() > 0; });
+				if (pending_jobs.size() == 0) // stop_workers is set and there is nothing left to do
+					return;
+				job = std::move(pending_jobs.front().job);
+				pending_jobs.pop_front();
+			}
+			job();
+		}
+	}
+
+}; // namespace chaos
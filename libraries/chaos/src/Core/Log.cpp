@@ -72,6 +72,14 @@ namespace chaos
 	}
 
 	void FileLoggerListener::Flush()
+	{
+		if (logger != nullptr)
+			logger->Flush(); // write the pending lines first (calls OnFlush())
+		else
+			OnFlush();
+	}
+
+	void FileLoggerListener::OnFlush()
 	{
 		if (output_file.is_open())
 		{
@@ -86,8 +94,10 @@ namespace chaos
 		{
 			output_file.open(log_path.c_str(), std::ofstream::binary | std::ofstream::trunc);
 			if (output_file.is_open())
-				for (LogLine const& line : in_logger->GetLines())
+				in_logger->ForEachLine([this](LogLine const& line)
+				{
 					OnNewLine(line);
+				});
 		}
 	}
 
@@ -125,12 +135,23 @@ namespace chaos
 	// Log implementation
 	// ================================================================
 
+	Logger::Logger()
+	{
+		writer_thread = std::thread([this]() { WriterLoop(); });
+	}
+
 	Logger::~Logger()
 	{
+		// stop the writer thread and handle the remaining lines
+		stop_writer = true;
+		writer_condition.notify_all();
+		if (writer_thread.joinable())
+			writer_thread.join();
+		DispatchPendingLines();
 		// remove all listeners
-		while (listeners.size() > 0)
+		while (GetListenerCount() > 0)
 		{
-			listeners[0]->SetLogger(nullptr);
+			GetListener(0)->SetLogger(nullptr);
 		}
 		// remove all domains
 		for (std::string* d : domains)
@@ -140,9 +161,8 @@ namespace chaos
 	Logger* Logger::GetInstance()
 	{
 		// XXX : use a share pointer so that we are sure it is being destroyed at the end of the application (and so the output_file is being flushed)
-		static shared_ptr<Logger> result;
-		if (result == nullptr)
-			result = new Logger();
+		//       the static initialization is thread-safe : the logger may be first used by any thread
+		static shared_ptr<Logger> result = new Logger();
 		return result.get();
 	}
 
@@ -150,6 +170,8 @@ namespace chaos
 	{
 		assert(listener != nullptr);
 		assert(listener->logger == nullptr);
+
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
 		listener->logger = this;
 		listeners.push_back(listener);
 		listener->OnAttachedToLogger(this);
@@ -161,11 +183,124 @@ namespace chaos
 		assert(listener->logger == this);
 
 		shared_ptr<LoggerListener> prevent_destruction = listener;
+
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
 		listener->logger = nullptr;
 		listeners.erase(std::find(listeners.begin(), listeners.end(), listener));
 		listener->OnDetachedFromLogger(this);
 	}
 
+	size_t Logger::GetListenerCount() const
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		return listeners.size();
+	}
+
+	LoggerListener* Logger::GetListener(size_t index)
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		return listeners[index].get();
+	}
+
+	LoggerListener const* Logger::GetListener(size_t index) const
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		return listeners[index].get();
+	}
+
+	size_t Logger::GetDomainCount() const
+	{
+		boost::shared_lock<boost::shared_mutex> lock(domain_mutex);
+		return domains.size();
+	}
+
+	char const* Logger::GetDomain(size_t index) const
+	{
+		boost::shared_lock<boost::shared_mutex> lock(domain_mutex);
+		return domains[index]->c_str();
+	}
+
+	std::vector<LogLine> Logger::GetLines() const
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		return { lines.begin(), lines.end() };
+	}
+
+	void Logger::ForEachLine(LightweightFunction<void(LogLine const&)> func) const
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		for (LogLine const& line : lines)
+			func(line);
+	}
+
+	void Logger::SetMaxLineCount(std::optional<size_t> in_max_line_count)
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		max_line_count = in_max_line_count;
+		if (max_line_count.has_value() && lines.size() > max_line_count.value())
+			lines.erase(lines.begin(), lines.begin() + (lines.size() - max_line_count.value()));
+	}
+
+	std::optional<size_t> Logger::GetMaxLineCount() const
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		return max_line_count;
+	}
+
+	void Logger::Flush()
+	{
+		size_t target_count = pushed_line_count.load(boost::memory_order_acquire);
+		writer_condition.notify_one();
+
+		boost::unique_lock<boost::recursive_mutex> lock(dispatch_mutex);
+		// a listener flushing while lines are being dispatched cannot wait for them
+		if (dispatching_thread != std::this_thread::get_id())
+			dispatch_condition.wait(lock, [this, target_count]() { return dispatched_line_count.load() >= target_count || stop_writer; });
+		for (auto& listener : listeners)
+			listener->OnFlush();
+	}
+
+	void Logger::WriterLoop()
+	{
+		while (!stop_writer)
+		{
+			DispatchPendingLines();
+
+			// wait for new lines (a notification may be missed since producers do not lock the mutex : use a timeout)
+			boost::unique_lock<boost::mutex> lock(writer_mutex);
+			if (!stop_writer && dispatched_line_count.load() >= pushed_line_count.load(boost::memory_order_acquire))
+				writer_condition.wait_for(lock, boost::chrono::milliseconds(10));
+		}
+	}
+
+	void Logger::DispatchPendingLines()
+	{
+		boost::lock_guard<boost::recursive_mutex> lock(dispatch_mutex);
+		std::thread::id previous_dispatching_thread = dispatching_thread; // a listener may log and dispatch recursively
+		dispatching_thread = std::this_thread::get_id();
+
+		LogLine new_line;
+		size_t count = 0;
+		while (pending_lines.TryPop(new_line))
+		{
+			new_line.line_index = next_line_index++;
+			// notify all listener for this new line
+			for (auto& listener : listeners)
+				listener->OnNewLine(new_line);
+			// store the line
+			lines.push_back(std::move(new_line));
+			if (max_line_count.has_value() && lines.size() > max_line_count.value())
+				lines.pop_front();
+			++count;
+		}
+		if (count > 0)
+		{
+			dispatched_line_count += count;
+			dispatch_condition.notify_all();
+		}
+		dispatching_thread = previous_dispatching_thread;
+	}
+
 	void Logger::BeginTransaction(std::string_view domain, LogSeverity severity)
 	{
 		assert(!IsTransactionInProgress());
@@ -220,18 +355,18 @@ namespace chaos
 
 	void Logger::DoOutput(char const * domain, LogSeverity severity, std::string_view buffer)
 	{
-		// register the new line
+		// prepare the new line (the index is given by the dispatch)
 		LogLine new_line;
-		new_line.line_index = next_line_index++;
 		new_line.severity = severity;
 		new_line.content = buffer;
 		new_line.time = std::chrono::system_clock::now();
 		new_line.domain = domain;
-		lines.push_back(new_line);
 
-		// notify all listener for this new line
-		for (auto& listener : listeners)
-			listener->OnNewLine(new_line);
+		// the ring buffer is full : do the work of the writer thread
+		while (!pending_lines.TryPush(std::move(new_line)))
+			DispatchPendingLines();
+		pushed_line_count.fetch_add(1, boost::memory_order_release);
+		writer_condition.notify_one();
 	}
 
 	char const* Logger::RegisterDomain(std::string_view domain)
@@ -245,12 +380,21 @@ namespace chaos
 		//      std::vector<std:string>
 
 		// search if domain is already registered
-		for (std::string const * d : domains)
-			if (*d == domain)
-				return d->c_str();
-		// create a new string for the incoming domain
-		domains.push_back(new std::string(domain));
-		return domains[domains.size() - 1]->c_str();
+		{
+			boost::shared_lock<boost::shared_mutex> lock(domain_mutex);
+			auto it = domain_map.find(domain);
+			if (it != domain_map.end())
+				return it->second;
+		}
+		// create a new string for the incoming domain (it may have been created by another thread meanwhile)
+		boost::unique_lock<boost::shared_mutex> lock(domain_mutex);
+		auto it = domain_map.find(domain);
+		if (it != domain_map.end())
+			return it->second;
+		std::string * new_domain = new std::string(domain);
+		domains.push_back(new_domain);
+		domain_map[*new_domain] = new_domain->c_str();
+		return new_domain->c_str();
 	}
 
 }; // namespace chaos
@@ -0,0 +1,74 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	void ObjectRequestIndex::Clear()
+	{
+		built = false;
+		element_count = 0;
+		element_data = nullptr;
+		direct_tag_base = 0;
+		direct_tags.clear();
+		other_tags.clear();
+		names.clear();
+	}
+
+	size_t ObjectRequestIndex::GetNameHash(char const* name)
+	{
+		// FNV-1a on lower case characters (same case folding than StringTools::Stricmp(...))
+		uint64_t result = 14695981039346656037ULL;
+		if (name != nullptr)
+		{
+			for (; *name != 0; ++name)
+			{
+				result ^= uint64_t(std::tolower((unsigned char)*name));
+				result *= 1099511628211ULL;
+			}
+		}
+		return size_t(result);
+	}
+
+	void ObjectRequestIndex::PrepareDirectTags(TagType min_tag, TagType max_tag)
+	{
+		assert(min_tag <= max_tag);
+
+		// the table only covers the tags in use, and only if it is not much bigger than the number of elements
+		size_t range = size_t(max_tag - min_tag);
+		if (range >= std::max(min_direct_tag_range, direct_tag_density * element_count))
+			return;
+		direct_tag_base = min_tag;
+		direct_tags.assign(range + 1, INVALID_INDEX);
+	}
+
+	void ObjectRequestIndex::AddEntry(char const* name, TagType tag, size_t index)
+	{
+		names.emplace(GetNameHash(name), index);
+
+		// keep the first element for each tag
+		if (tag >= direct_tag_base && tag - direct_tag_base < direct_tags.size())
+		{
+			if (direct_tags[tag - direct_tag_base] == INVALID_INDEX)
+				direct_tags[tag - direct_tag_base] = uint32_t(index);
+		}
+		else
+		{
+			other_tags.emplace(tag, index);
+		}
+	}
+
+	std::optional<size_t> ObjectRequestIndex::FindTagIndex(TagType tag) const
+	{
+		if (tag >= direct_tag_base && tag - direct_tag_base < direct_tags.size())
+		{
+			if (direct_tags[tag - direct_tag_base] != INVALID_INDEX)
+				return direct_tags[tag - direct_tag_base];
+			return {};
+		}
+		auto it = other_tags.find(tag);
+		if (it != other_tags.end())
+			return it->second;
+		return {};
+	}
+
+}; // namespace chaos
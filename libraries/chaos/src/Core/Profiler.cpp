@@ -0,0 +1,235 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	/**
+	 * ProfilerThreadBuffer
+	 */
+
+	ProfilerThreadBuffer::ProfilerThreadBuffer(size_t in_thread_index, size_t capacity):
+		thread_index(in_thread_index),
+		pending_events(std::max(capacity, size_t(1)))
+	{
+		events.resize(std::max(capacity, size_t(1)));
+	}
+
+	void ProfilerThreadBuffer::Push(ProfilerEvent const& event)
+	{
+		ProfilerEvent pending_event = event;
+		if (!pending_events.TryPush(std::move(pending_event)))
+			dropped_count.fetch_add(1, boost::memory_order_relaxed);
+	}
+
+	size_t ProfilerThreadBuffer::ExtractNewEvents(std::vector<ProfilerEvent>& result)
+	{
+		ProfilerEvent event;
+		while (pending_events.TryPop(event))
+		{
+			result.push_back(event);
+			events[size_t(write_count % events.size())] = event;
+			++write_count;
+		}
+		return dropped_count.exchange(0, boost::memory_order_relaxed);
+	}
+
+	void ProfilerThreadBuffer::GetEvents(std::vector<ProfilerEvent>& result) const
+	{
+		uint64_t first = (write_count > events.size())? write_count - events.size() : 0;
+		for (uint64_t i = first; i < write_count; ++i)
+			result.push_back(events[size_t(i % events.size())]);
+	}
+
+	void ProfilerThreadBuffer::Clear()
+	{
+		ProfilerEvent event;
+		while (pending_events.TryPop(event));
+		dropped_count.store(0, boost::memory_order_relaxed);
+		write_count = 0;
+	}
+
+	/**
+	 * ProfilerThreadBufferOwner : the reference of a thread on its buffer
+	 */
+
+	class ProfilerThreadBufferOwner
+	{
+	public:
+
+		/** destructor (the thread exits) */
+		~ProfilerThreadBufferOwner()
+		{
+			if (buffer != nullptr)
+				buffer->Release();
+		}
+
+		/** the buffer of the thread */
+		shared_ptr<ProfilerThreadBuffer> buffer;
+	};
+
+	/**
+	 * Profiler
+	 */
+
+	boost::atomic<bool> Profiler::enabled{ false };
+
+	Profiler::Profiler():
+		origin_timestamp(GetTimestamp())
+	{
+	}
+
+	Profiler::~Profiler()
+	{
+		// the zones that start after the destruction are not recorded
+		SetEnabled(false);
+	}
+
+	void Profiler::SetEnabled(bool in_enabled)
+	{
+		enabled.store(in_enabled, boost::memory_order_relaxed);
+	}
+
+	int64_t Profiler::GetTimestamp()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	ProfilerThreadBuffer* Profiler::GetThreadBuffer()
+	{
+		// XXX : there is a single profiler, so a thread_local reference is enough to find the buffer of the thread
+		//       the thread shares the ownership of its buffer, so that the buffer lives as long as the thread may use it
+		static thread_local ProfilerThreadBufferOwner thread_buffer_owner;
+		if (thread_buffer_owner.buffer == nullptr)
+		{
+			boost::lock_guard<boost::mutex> lock(mutex);
+			// reuse the buffer of a thread that has exited
+			for (auto& thread_buffer : thread_buffers)
+			{
+				if (!thread_buffer->in_use.load(boost::memory_order_acquire))
+				{
+					thread_buffer->in_use.store(true, boost::memory_order_relaxed);
+					thread_buffer_owner.buffer = thread_buffer;
+					break;
+				}
+			}
+			// or create a new one
+			if (thread_buffer_owner.buffer == nullptr)
+			{
+				thread_buffers.push_back(new ProfilerThreadBuffer(thread_buffers.size(), default_event_capacity));
+				thread_buffer_owner.buffer = thread_buffers.back();
+			}
+		}
+		return thread_buffer_owner.buffer.get();
+	}
+
+	void Profiler::RecordZone(char const* name, int64_t start, int64_t end)
+	{
+		assert(name != nullptr);
+		GetThreadBuffer()->Push({ name, start, end });
+	}
+
+	void Profiler::EndFrame()
+	{
+		int64_t frame_end_timestamp = GetTimestamp();
+
+		if (!IsEnabled())
+		{
+			frame_start_timestamp = 0;
+			return;
+		}
+		// the frame itself is a zone (for the traces)
+		if (frame_start_timestamp != 0)
+			RecordZone("Frame", frame_start_timestamp, frame_end_timestamp);
+		frame_start_timestamp = frame_end_timestamp;
+
+		boost::lock_guard<boost::mutex> lock(mutex);
+
+		// collect the events of all threads since the previous frame
+		extracted_events.clear();
+		for (auto& thread_buffer : thread_buffers)
+			lost_event_count += thread_buffer->ExtractNewEvents(extracted_events);
+
+		// reset the values of the frame
+		for (auto& [name, statistics] : zone_statistics)
+		{
+			statistics.frame_call_count = 0;
+			statistics.frame_duration = 0.0;
+		}
+		// accumulate the events
+		for (ProfilerEvent const& event : extracted_events)
+		{
+			ProfilerZoneStatistics& statistics = zone_statistics[event.name];
+			if (statistics.name == nullptr)
+				statistics.name = event.name;
+
+			double duration = double(event.end - event.start) * 1.0e-6;
+			statistics.frame_call_count += 1;
+			statistics.frame_duration += duration;
+			statistics.max_call_duration = std::max(statistics.max_call_duration, duration);
+			statistics.total_call_count += 1;
+		}
+		// smooth the values
+		for (auto& [name, statistics] : zone_statistics)
+			statistics.average_frame_duration += (statistics.frame_duration - statistics.average_frame_duration) * average_factor;
+	}
+
+	std::vector<ProfilerZoneStatistics> Profiler::GetZoneStatistics() const
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+
+		std::vector<ProfilerZoneStatistics> result;
+		result.reserve(zone_statistics.size());
+		for (auto const& [name, statistics] : zone_statistics)
+			result.push_back(statistics);
+		return result;
+	}
+
+	size_t Profiler::GetLostEventCount() const
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+		return lost_event_count;
+	}
+
+	void Profiler::Clear()
+	{
+		boost::lock_guard<boost::mutex> lock(mutex);
+		for (auto& thread_buffer : thread_buffers)
+			thread_buffer->Clear();
+		zone_statistics.clear();
+		lost_event_count = 0;
+	}
+
+	bool Profiler::SaveChromeTrace(FilePathParam const& path) const
+	{
+		nlohmann::json trace_events = nlohmann::json::array();
+		{
+			boost::lock_guard<boost::mutex> lock(mutex);
+
+			std::vector<ProfilerEvent> events;
+			for (auto const& thread_buffer : thread_buffers)
+			{
+				events.clear();
+				thread_buffer->GetEvents(events);
+
+				for (ProfilerEvent const& event : events)
+				{
+					// complete events. times are in microseconds
+					nlohmann::json json_event = nlohmann::json::object();
+					json_event["name"] = event.name;
+					json_event["ph"] = "X";
+					json_event["ts"] = double(event.start - origin_timestamp) * 1.0e-3;
+					json_event["dur"] = double(event.end - event.start) * 1.0e-3;
+					json_event["pid"] = 0;
+					json_event["tid"] = thread_buffer->GetThreadIndex();
+					trace_events.push_back(std::move(json_event));
+				}
+			}
+		}
+
+		nlohmann::json json = nlohmann::json::object();
+		json["traceEvents"] = std::move(trace_events);
+		json["displayTimeUnit"] = "ms";
+		return JSONTools::SaveJSONToFile(&json, path);
+	}
+
+}; // namespace chaos
\ No newline at end of file
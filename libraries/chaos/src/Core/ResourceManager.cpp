@@ -3,6 +3,40 @@
 
 namespace chaos
 {
+	/**
+	* ResourceLoadingHandle
+	*/
+
+	ResourceLoadingHandle::ResourceLoadingHandle(Object* in_resource)
+	{
+		SetResult(in_resource);
+	}
+
+	void ResourceLoadingHandle::SetResult(Object* in_resource)
+	{
+		resource = in_resource;
+		status = (in_resource != nullptr) ? ResourceLoadingStatus::SUCCEEDED : ResourceLoadingStatus::FAILED;
+	}
+
+	/**
+	* ResourceManager
+	*/
+
+	ResourceManager::~ResourceManager()
+	{
+		// the workers reference the manager : wait for them (the finalization cannot be done anymore because the derived part is already destroyed)
+		// the pending finalizations own the data prepared by the workers : destroying them releases these data
+		while (true)
+		{
+			{
+				boost::lock_guard<boost::mutex> lock(loading_mutex);
+				if (finalize_tasks.size() == loading_task_count - finalized_task_count)
+					break;
+			}
+			std::this_thread::yield();
+		}
+		finalize_tasks.clear();
+	}
 
 	bool ResourceManager::StartManager()
 	{
@@ -21,6 +55,7 @@ namespace chaos
 	{
 		if (!IsManagerStarted())
 			return false;
+		FlushLoadingTasks();
 		DoStopManager();
 		manager_started = true;
 		return true;
@@ -46,6 +81,94 @@ namespace chaos
 		return true;
 	}
 
+	void ResourceManager::SetAsynchronousLoading(bool in_asynchronous_loading)
+	{
+		asynchronous_loading = in_asynchronous_loading;
+	}
+
+	bool ResourceManager::IsAsynchronousLoading() const
+	{
+		return asynchronous_loading;
+	}
+
+	void ResourceManager::PushLoadingTask(std::function<std::function<void()>()> prepare_func)
+	{
+		assert(prepare_func);
+		JobManager* job_manager = JobManager::GetInstance();
+		{
+			boost::lock_guard<boost::mutex> lock(loading_mutex);
+			if (loading_job_group == 0)
+				loading_job_group = job_manager->NewJobGroup();
+			++loading_task_count;
+		}
+		job_manager->PushJob([this, prepare_func = std::move(prepare_func)]()
+		{
+			std::function<void()> finalize_func = prepare_func();
+
+			boost::lock_guard<boost::mutex> lock(loading_mutex);
+			if (finalize_func)
+				finalize_tasks.push_back(std::move(finalize_func));
+			else
+				finalize_tasks.push_back([]() {}); // still to be counted
+		}, loading_job_group);
+	}
+
+	size_t ResourceManager::ProcessLoadingTasks(std::optional<float> max_duration)
+	{
+		CHAOS_PROFILE_ZONE("ResourceManager::ProcessLoadingTasks");
+
+		auto start = std::chrono::steady_clock::now();
+
+		size_t result = 0;
+		while (true)
+		{
+			std::function<void()> finalize_func;
+			{
+				boost::lock_guard<boost::mutex> lock(loading_mutex);
+				if (finalize_tasks.size() == 0)
+					break;
+				finalize_func = std::move(finalize_tasks.front());
+				finalize_tasks.pop_front();
+			}
+			finalize_func(); // outside the lock : it may push other loadings
+			++result;
+
+			{
+				boost::lock_guard<boost::mutex> lock(loading_mutex);
+				if (++finalized_task_count == loading_task_count) // everything is over : restart the progression
+					loading_task_count = finalized_task_count = 0;
+			}
+
+			if (max_duration.has_value() && std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() >= max_duration.value())
+				break;
+		}
+		return result;
+	}
+
+	void ResourceManager::FlushLoadingTasks()
+	{
+		// help the workers with the loadings that have not started yet instead of just waiting for them
+		JobManager* job_manager = JobManager::GetInstance();
+		while (GetPendingLoadingCount() > 0)
+			if (ProcessLoadingTasks() == 0)
+				if (!job_manager->ExecutePendingJob(loading_job_group))
+					std::this_thread::yield();
+	}
+
+	size_t ResourceManager::GetPendingLoadingCount() const
+	{
+		boost::lock_guard<boost::mutex> lock(loading_mutex);
+		return loading_task_count - finalized_task_count;
+	}
+
+	float ResourceManager::GetLoadingProgress() const
+	{
+		boost::lock_guard<boost::mutex> lock(loading_mutex);
+		if (loading_task_count == 0)
+			return 1.0f;
+		return float(finalized_task_count) / float(loading_task_count);
+	}
+
 	bool ResourceManager::CanAddObject(ObjectRequest request, LightweightFunction<bool(ObjectRequest)> can_add_func) const
 	{
 		// manager initialized ?
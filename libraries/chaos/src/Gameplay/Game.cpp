@@ -61,6 +61,8 @@ namespace chaos
 
 	void Game::Tick(float delta_time)
 	{
+		CHAOS_PROFILE_ZONE("Game::Tick");
+
 		// update player inputs
 		TickGameInputs(delta_time);
 		// tick the free camera
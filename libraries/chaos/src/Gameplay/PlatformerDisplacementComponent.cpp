@@ -282,10 +282,11 @@ namespace chaos
 				{
 					collision_flags |= PlatformerDisplacementCollisionFlags::TOUCHING_LADDER;
 				}
+				return false; // the ladders never stop the pawn
 			}
 			else
 			{
-				computer.ComputeReaction(collision_info, [&collision_flags](TileCollisionInfo const& collision_info, Edge edge)
+				return computer.ComputeReaction(collision_info, [&collision_flags](TileCollisionInfo const& collision_info, Edge edge)
 				{
 					if (edge == Edge::TOP)
 					{
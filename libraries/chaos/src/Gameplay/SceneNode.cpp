@@ -29,49 +29,104 @@ namespace chaos
 		return parent_to_local;
 	}
 
-	glm::mat4 SceneNode::GetWorldToLocal() const
+	glm::mat4 const & SceneNode::GetWorldToLocal() const
 	{
-		glm::mat4 result = GetParentToLocal();
-
-		SceneNode const * node = parent_node.get();
-		while (node != nullptr)
+		if (cache_state & INVALID_WORLD_TO_LOCAL)
 		{
-			result = result * node->GetParentToLocal();
-			node = node->parent_node.get();
+			SceneNode const * parent = parent_node.get();
+			if (parent != nullptr)
+				world_to_local = GetParentToLocal() * parent->GetWorldToLocal();
+			else
+				world_to_local = GetParentToLocal();
+			cache_state &= ~INVALID_WORLD_TO_LOCAL;
 		}
-		return result;
+		return world_to_local;
 	}
 
-	glm::mat4 SceneNode::GetLocalToWorld() const
+	glm::mat4 const & SceneNode::GetLocalToWorld() const
 	{
-		glm::mat4 result = GetLocalToParent();
+		if (cache_state & INVALID_LOCAL_TO_WORLD)
+		{
+			SceneNode const * parent = parent_node.get();
+			if (parent != nullptr)
+				local_to_world = parent->GetLocalToWorld() * GetLocalToParent();
+			else
+				local_to_world = GetLocalToParent();
+			cache_state &= ~INVALID_LOCAL_TO_WORLD;
+		}
+		return local_to_world;
+	}
 
-		SceneNode const* node = parent_node.get();
-		while (node != nullptr)
+	void SceneNode::UpdateWorldTransforms()
+	{
+		// nothing to update in the sub-tree
+		if ((cache_state & (INVALID_WORLD | INVALID_DESCENDANT_WORLD)) == 0)
+			return;
+
+		// a node is updated before its children are pushed : the parents are always updated first
+		std::vector<SceneNode*> update_stack;
+		update_stack.push_back(this);
+		while (update_stack.size() > 0)
 		{
-			result = node->GetLocalToParent() * result;
-			node = node->parent_node.get();
+			SceneNode * node = update_stack.back();
+			update_stack.pop_back();
+
+			if (node->cache_state & INVALID_WORLD)
+			{
+				node->GetLocalToWorld();
+				node->GetWorldToLocal();
+			}
+			node->cache_state &= ~INVALID_DESCENDANT_WORLD;
+
+			// only the children with something to update (the clean sub-trees are skipped)
+			for (shared_ptr<SceneNode> const & child : node->child_nodes)
+				if (child != nullptr && (child->cache_state & (INVALID_WORLD | INVALID_DESCENDANT_WORLD)) != 0)
+					update_stack.push_back(child.get());
 		}
-		return result;
 	}
 
+	void SceneNode::InvalidateTransforms()
+	{
+		cache_state |= (INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL);
+		InvalidateWorldTransforms();
+	}
+
+	void SceneNode::InvalidateWorldTransforms()
+	{
+		DoInvalidateWorldTransforms();
+
+		// mark the ancestors (stop at the first one already marked : its own ancestors are marked too)
+		for (SceneNode * parent = parent_node.get(); parent != nullptr && (parent->cache_state & INVALID_DESCENDANT_WORLD) == 0; parent = parent->parent_node.get())
+			parent->cache_state |= INVALID_DESCENDANT_WORLD;
+	}
+
+	void SceneNode::DoInvalidateWorldTransforms()
+	{
+		// the descendants of an invalid node are invalid too
+		if ((cache_state & INVALID_WORLD) == INVALID_WORLD)
+			return;
+		cache_state |= INVALID_WORLD;
+		for (shared_ptr<SceneNode> & child : child_nodes)
+			if (child != nullptr)
+				child->DoInvalidateWorldTransforms();
+	}
 
 	void SceneNode::SetPosition(glm::vec2 const& in_position)
 	{
 		transform.position = in_position;
-		cache_state |= (INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL);
+		InvalidateTransforms();
 	}
 
 	void SceneNode::SetScale(glm::vec2 const & in_scale)
 	{
 		transform.scale = in_scale;
-		cache_state |= (INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL);
+		InvalidateTransforms();
 	}
 
 	void SceneNode::SetRotator(float in_rotator)
 	{
 		transform.rotator = in_rotator;
-		cache_state |= (INVALID_LOCAL_TO_PARENT | INVALID_PARENT_TO_LOCAL);
+		InvalidateTransforms();
 	}
 
 
@@ -81,6 +136,8 @@ namespace chaos
 		assert(in_child->parent_node == nullptr);
 
 		child_nodes.push_back(in_child);
+		in_child->parent_node = this;
+		in_child->InvalidateWorldTransforms();
 	}
 
 	void SceneNode::RemoveChildNode(SceneNode* in_child)
@@ -94,6 +151,7 @@ namespace chaos
 			if (child_nodes[i] == in_child)
 			{
 				child_nodes[i]->parent_node = nullptr;
+				child_nodes[i]->InvalidateWorldTransforms();
 				child_nodes.erase(child_nodes.begin() + i); // may call destructor
 				return;
 			}
@@ -10,6 +10,8 @@ namespace chaos
 			// set a reference on the local_to_world transform
 			GPUProgramProviderChain main_uniform_provider(uniform_provider);
 			main_uniform_provider.AddVariableReference("local_to_world", local_to_world);
+			// update the cached world matrices once for the whole frame
+			root_node->UpdateWorldTransforms();
 			// start the rendering recursion
 			DisplayNode(root_node, renderer, uniform_provider, render_params);
 		}
@@ -24,8 +26,8 @@ namespace chaos
 			return;
 		// store transformation matrix (this is usefull while we use a VariableReference in ProviderChain)
 		glm::mat4 previous_local_to_world = local_to_world;
-		// update transformation matrix
-		local_to_world = local_to_world * node->GetLocalToParent();
+		// use the cached world matrix (updated by DisplayScene(...) for the whole frame)
+		local_to_world = node->GetLocalToWorld();
 		// display node and its children
 		node->Display(renderer, uniform_provider, render_params);
 		for (auto& child : node->ChildrenNodes())
@@ -105,6 +105,19 @@ namespace chaos
 	// |     +----+     |
 	//               +-----------
 	//               |
+	//
+	// Fast movers
+	// -----------
+	//
+	//   Testing the destination only, a PAWN moving further than a tile in a single frame can go through it (tunneling)
+	//
+	//   +----+         +--+         +----+
+	//   |SRC | ------> |  | ------> |DST |
+	//   +----+         +--+         +----+
+	//
+	//   The cells of the grid are walked along the move (DDA) and the tiles are sorted by their time of impact.
+	//   When DST does not touch a tile that has been crossed, the PAWN is brought back where it touches the tile
+	//   before the reaction is computed (and is released whether there is no reaction for that tile)
 
 	static bool RangeOverlaps(std::pair<glm::vec2, glm::vec2> const & range1, std::pair<glm::vec2, glm::vec2> const& range2, int component)
 	{
@@ -113,37 +126,158 @@ namespace chaos
 		return true;
 	}
 
-	box2 TileCollisionComputer::Run(LightweightFunction<void(TileCollisionInfo const& collision_info)> func)
+	// the time (in [0, 1]) when a moving box starts touching another box. returns false whether this does not happen during the move
+	static bool ComputeTimeOfImpact(box2 const& moving_box, glm::vec2 const& delta, box2 const& other_box, float& result)
+	{
+		std::pair<glm::vec2, glm::vec2> moving_corners = GetBoxCorners(moving_box);
+		std::pair<glm::vec2, glm::vec2> other_corners = GetBoxCorners(other_box);
+
+		float enter_time = 0.0f;
+		float exit_time = 1.0f;
+		for (int component = 0; component < 2; ++component)
+		{
+			if (delta[component] == 0.0f)
+			{
+				// no move along this axis : ranges must already overlap
+				if (!RangeOverlaps(moving_corners, other_corners, component))
+					return false;
+			}
+			else
+			{
+				float t1 = (other_corners.first[component] - moving_corners.second[component]) / delta[component];
+				float t2 = (other_corners.second[component] - moving_corners.first[component]) / delta[component];
+				if (t1 > t2)
+					std::swap(t1, t2);
+				enter_time = std::max(enter_time, t1);
+				exit_time = std::min(exit_time, t2);
+				if (enter_time > exit_time)
+					return false;
+			}
+		}
+		result = enter_time;
+		return true;
+	}
+
+	// the buffers of TileCollisionComputer::Run(...), kept from one call to another to avoid allocations
+	class TileCollisionScratchBuffers
+	{
+	public:
+
+		/** the tiles touched along the move with their time of impact */
+		std::vector<std::pair<float, TileCollisionInfo>> contacts;
+		/** the cells crossed by the move */
+		std::vector<glm::ivec2> cells;
+		/** the entries of the crossed cells */
+		std::vector<uint32_t> entries;
+	};
+
+	static thread_local TileCollisionScratchBuffers scratch_buffers;
+
+	box2 TileCollisionComputer::Run(LightweightFunction<bool(TileCollisionInfo const& collision_info)> func)
 	{
 		assert(level_instance != nullptr);
 
 		// work on extended copy of the box
-		box2 extended_box = src_box | dst_box;
+		box2 extended_box = src_box;
+		extended_box.half_size += box_extend;
+
+		// XXX : the contacts are taken from the scratch buffers and given back at the end, so that 'func' may use another TileCollisionComputer.
+		//       The cells and the entries are only used before 'func' is called
+		std::vector<std::pair<float, TileCollisionInfo>> contacts = std::move(scratch_buffers.contacts);
+		std::vector<glm::ivec2>& cells = scratch_buffers.cells;
+		std::vector<uint32_t>& entries = scratch_buffers.entries;
+		contacts.clear();
+
+		// collect the tiles touched along the move
+		for (TMLayerInstanceIterator it(level_instance, collision_mask); it; ++it)
+		{
+			TMParticleGrid const* grid = it->GetParticleGrid();
+			if (grid == nullptr || grid->GetEntryCount() == 0)
+				continue;
 
-		glm::vec2 delta = box_extend;
-		extended_box.half_size += delta;
+			auto AddContact = [this, &it, &extended_box, &contacts, grid](uint32_t entry_index)
+			{
+				TMParticleGridEntry const& entry = grid->GetEntry(entry_index);
 
-		glm::vec2 delta_position = dst_box.position - src_box.position;
+				float time_of_impact = 0.0f;
+				if (!ComputeTimeOfImpact(extended_box, delta_position, entry.bounding_box, time_of_impact))
+					return;
 
-		// iterate over all particles
-		TMTileCollisionIterator it = level_instance->GetTileCollisionIterator(extended_box, collision_mask, false);
-		while (it)
+				ParticleAllocationBase* allocation = it->GetParticleLayer()->GetAllocation(entry.allocation_index);
+				if (allocation == nullptr || allocation == ignore_allocation)
+					return;
+
+				RawDataBufferAccessorBase<TMParticle> accessor = allocation->GetParticleAccessor(0, 0);
+
+				TileCollisionInfo collision_info;
+				collision_info.layer_instance = &(*it);
+				collision_info.allocation = allocation;
+				collision_info.particle = &accessor[entry.particle_index];
+				collision_info.tile_info = level_instance->GetTiledMap()->FindTileInfo(collision_info.particle->gid);
+				contacts.push_back({ time_of_impact, collision_info });
+			};
+
+			// the candidates (do not walk more cells than there are entries)
+			cells.clear();
+			if (grid->GetSweptCells(extended_box, delta_position, cells, grid->GetEntryCount()))
+			{
+				// the large entries are never in the cells
+				for (uint32_t entry_index : grid->GetLargeEntries())
+					AddContact(entry_index);
+
+				entries.clear();
+				for (glm::ivec2 const& cell : cells)
+					if (std::vector<uint32_t> const* cell_entries = grid->GetCellEntries(cell))
+						entries.insert(entries.end(), cell_entries->begin(), cell_entries->end());
+				// a particle covering several cells is only checked once
+				std::sort(entries.begin(), entries.end());
+				entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+				for (uint32_t entry_index : entries)
+					AddContact(entry_index);
+			}
+			else
+			{
+				for (size_t i = 0; i < grid->GetEntryCount(); ++i)
+					AddContact(uint32_t(i));
+			}
+		}
+
+		// give caller opportunity to do what he wants, in the order the tiles are reached
+		std::stable_sort(contacts.begin(), contacts.end(), [](auto const& c1, auto const& c2)
+		{
+			return c1.first < c2.first;
+		});
+
+		for (auto const& [time_of_impact, collision_info] : contacts)
 		{
-			// ignore pawn allocation
-			if (it->allocation == ignore_allocation)
+			box2 const& particle_box = collision_info.particle->bounding_box;
+
+			// the tile has been crossed (and not touched at the end of the move) : bring the box back where it touches the tile
+			// (a tile that src_box already touches has a null time of impact : this is not tunneling, the box must not be brought back)
+			box2 wanted_box = dst_box;
+
+			bool tunneling = false;
+			float dst_time_of_impact = 0.0f;
+			if (!Collide(dst_box, particle_box, false) && ComputeTimeOfImpact(src_box, dst_box.position - src_box.position, particle_box, dst_time_of_impact) && dst_time_of_impact > 0.0f && dst_time_of_impact < 1.0f)
 			{
-				it.NextAllocation();
-				continue;
+				dst_box.position = src_box.position + (dst_box.position - src_box.position) * dst_time_of_impact;
+				tunneling = true;
 			}
-			// give caller opportunity to do what he wants
-			func(*it);
-			// next
-			++it;
+
+			// no reaction (bridges, ladders, ignored edges ...) : the move goes on
+			if (!func(collision_info) && tunneling)
+				dst_box = wanted_box;
 		}
+
+		// give the buffer back for the next calls
+		contacts.clear();
+		scratch_buffers.contacts = std::move(contacts);
+
 		return dst_box;
 	}
 
-	void TileCollisionComputer::ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const &, Edge)> func)
+	bool TileCollisionComputer::ComputeReaction(TileCollisionInfo const& collision_info, LightweightFunction<bool(TileCollisionInfo const &, Edge)> func)
 	{
 		int particle_flags = collision_info.particle->flags;
 
@@ -154,7 +288,7 @@ namespace chaos
 		{
 			// cannot do anything without a known tileset : this should never happen
 			if (collision_info.tile_info.tileset == nullptr)
-				return;
+				return false;
 			// different tileset than the one for previous particle ?
 			if (collision_info.tile_info.tileset != tileset)
 			{
@@ -163,7 +297,7 @@ namespace chaos
 			}
 			// no wangset cannot continue
 			if (wangset == nullptr)
-				return;
+				return false;
 			// get the wang tile and apply particle transforms
 			wangtile = wangset->GetWangTile(collision_info.tile_info.id);
 			wangtile.ApplyParticleFlags(particle_flags);
@@ -313,10 +447,10 @@ namespace chaos
 		}
 
 		// displace the box among the best edge
-		if (best_distance != std::numeric_limits<float>::max())
-		{
-			dst_box.position = best_position;
-		}
+		if (best_distance == std::numeric_limits<float>::max())
+			return false;
+		dst_box.position = best_position;
+		return true;
 	}
 
 }; // namespace chaos
@@ -62,6 +62,15 @@ namespace chaos
 		return level_instance->GetLevel();
 	}
 
+	TMLayerInstance::~TMLayerInstance()
+	{
+		// XXX : the broad phase of the level is declared before the layers, so it still exists when the layers are destroyed
+		if (level_instance != nullptr)
+			for (auto const& object : objects)
+				if (object != nullptr)
+					level_instance->GetObjectBroadPhase().RemoveObject(object.get());
+	}
+
 	AutoCastable<TMLevelInstance> TMLayerInstance::GetLevelInstance()
 	{
 		return level_instance;
@@ -182,6 +191,11 @@ namespace chaos
 		offset = layer->offset;
 		name = layer->name;
 
+		// the particles are bucketed by tiles for collisions
+		if (TiledMap::Map const* tiled_map = level_instance->GetTiledMap())
+			if (tiled_map->tile_size.x > 0 && tiled_map->tile_size.y > 0)
+				particle_grid.SetCellSize(glm::vec2(tiled_map->tile_size));
+
 		// reset the bounding box
 		content_bounding_box = box2();
 		// special initialization
@@ -216,7 +230,13 @@ namespace chaos
 	{
 		// clear allocation if required
 		if (autoclean_particles && particle_layer != nullptr)
+		{
 			particle_layer->ClearAllAllocations();
+			// the streamed chunks are to be populated again (their objects are not concerned)
+			for (TMTileChunk& tile_chunk : tile_chunks)
+				tile_chunk.populated = false;
+			tile_chunk_visibility_dirty = true;
+		}
 		// restart all objects
 		size_t count = objects.size();
 		for (size_t i = 0; i < count; ++i)
@@ -397,7 +417,11 @@ namespace chaos
 		{
 			TMObject* result = factory(geometric_object, in_reference_solver);
 			if (result != nullptr)
+			{
 				objects.push_back(result);
+				if (level_instance != nullptr)
+					level_instance->GetObjectBroadPhase().InsertObject(result);
+			}
 			return result;
 		};
 		return result;
@@ -583,6 +607,88 @@ namespace chaos
 		return particle_layer.get();
 	}
 
+	bool TMLayerInstance::CreateTileContent(TiledMap::TileLayer const* tile_layer, glm::ivec2 const& tile_coord, TiledMap::Tile const& tile, TMParticlePopulator& particle_populator, TMObjectReferenceSolver* reference_solver, bool create_particle)
+	{
+		TiledMap::Map* tiled_map = level_instance->GetTiledMap();
+
+		int gid = tile.gid;
+		int particle_flags = tile.flags;
+		if (gid == 0)
+			return true;
+
+		// search the tile information
+		TiledMap::TileInfo tile_info = tiled_map->FindTileInfo(gid);
+		if (tile_info.tiledata == nullptr)
+			return true;
+
+		box2 particle_box = tile_layer->GetTileBoundingBox(tile_coord, tile_info.tiledata->image_size, particle_flags, false);
+
+		// try to create a geometric object from the tile
+		TMObjectFactory factory = GetObjectFactory(tile_info.tiledata);
+		if (factory)
+		{
+			if (reference_solver == nullptr) // the object has already been created (streamed layer)
+				return true;
+
+			// to avoid the creation of a TMObject, use a wrapper on the properties
+			PropertyOwnerOverride<TiledMap::GeometricObjectTile> tile_object = { nullptr, tile_info.tiledata };
+
+			// compute an ID base on 'tile_coord'
+			// TiledMap gives positive ID
+			// we want a negative ID to avoid conflicts
+			// for a 32 bits integer
+			// 15 bits for X
+			// 15 bits for Y
+			// 1  unused
+			// 1  bit for sign
+
+			int int_bit_count = 8 * sizeof(int);
+			int per_component_bit_count = (int_bit_count - 1) / 2;
+			int mask = ~((unsigned int)-1 << per_component_bit_count);
+			int idx = tile_coord.x & mask;
+			int idy = tile_coord.y & mask;
+			int object_id = -1 * (idx | (idy << per_component_bit_count));
+
+			tile_object.id = object_id;
+			tile_object.gid = gid;
+			tile_object.type = tile_info.tiledata->type;
+			tile_object.size = particle_box.half_size * 2.0f;
+
+			// shuyyy : should depend on the pivot ???
+			tile_object.position.x = particle_box.position.x - particle_box.half_size.x;
+			tile_object.position.y = particle_box.position.y - particle_box.half_size.y;
+
+			// XXX : for player start : but this is not a great idea to process by exception
+			//       We are writing int the fake object properties, not in the 'tile_info.tiledata'
+			//       That means that if 'tile_info.tiledata' already has a BITMAP_NAME property, this does not
+			//       interfere with that (a just in case value)
+			tile_object.CreatePropertyString("BITMAP_NAME", tile_info.tiledata->atlas_key.c_str());
+
+			TMObject* object = factory(&tile_object, *reference_solver);
+			if (object != nullptr)
+				if (ShouldCreateParticleForObject(&tile_object, object))
+					CreateObjectParticles(&tile_object, object, particle_populator);
+
+			return true; // while we have a factory, let the concerned object create its particle
+		}
+
+		Hotpoint hotpoint = Hotpoint::BOTTOM_LEFT;
+
+		// create a simple particle => as soon as there is an error, stop trying producing particles
+		bool keep_aspect_ratio = true;
+
+		if (!create_particle)
+			return true;
+		return particle_populator.AddParticle(
+			tile_info.tiledata->atlas_key.c_str(),
+			hotpoint, particle_box,
+			glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
+			0.0f,
+			particle_flags,
+			gid,
+			keep_aspect_ratio);
+	}
+
 	bool TMLayerInstance::InitializeTileLayer(TiledMap::TileLayer const * tile_layer, TMObjectReferenceSolver& reference_solver)
 	{
 		TMLevel* level = GetLevel();
@@ -590,137 +696,290 @@ namespace chaos
 		// create particle layer
 		if (CreateParticleLayer() == nullptr)
 			return false;
+		// the chunks are populated later, when the camera is near
+		if (tile_layer->IsStreamed())
+			return InitializeStreamedTileLayer(tile_layer, reference_solver);
 		// prepare the populator
 		TMParticlePopulator particle_populator;
 		if (!particle_populator.Initialize(this))
 			return false;
 
 		// populate the layer for each chunk
-		TiledMap::Map* tiled_map = level_instance->GetTiledMap();
-
 		bool particle_creation_success = true; // as soon as some particle creation fails, do not try to create other particles
 
-		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
-		{
-			size_t count = chunk.tile_indices.size();
-			for (size_t i = 0; i < count; ++i)
-			{
-				int gid = chunk.tile_indices[i].gid;
-				int particle_flags = chunk.tile_indices[i].flags;
-
+		// XXX : the tiles are grouped by square chunks of 'tile_chunk_size' tiles so that the chunks outside the camera can be hidden
+		//       (and their vertices not generated). With the default size (16), the chunks are aligned with the ones of the infinite TiledMap layers.
+		//       The tiles are still populated in the layer order (row-major), which is their drawing order : whenever a tile belongs to
+		//       another chunk than the previous one, a new allocation is started and given to the chunk of the tile
+		tile_chunk_size = layer->GetPropertyValueInt("TILE_CHUNK_SIZE", tile_chunk_size);
+		tile_chunks.clear();
+		tile_chunk_visibility_dirty = true;
 
+		auto GetChunkCoordinate = [this](int tile_coord)
+		{
+			return (tile_coord >= 0) ? tile_coord / tile_chunk_size : (tile_coord - tile_chunk_size + 1) / tile_chunk_size; // floor division
+		};
 
-				// shu48 recuperer le GID pour le spawn de particle
+		std::map<std::pair<int, int>, size_t> tile_chunk_indices;
 
+		glm::ivec2 current_chunk_coordinate = glm::ivec2(0, 0);
+		bool has_current_chunk = false;
 
+		// the particles of the current run go into their own allocation
+		auto FlushTileChunkAllocation = [this, &particle_populator, &particle_creation_success, &tile_chunk_indices, &current_chunk_coordinate, &has_current_chunk]()
+		{
+			if (!has_current_chunk || !particle_creation_success)
+				return;
+			particle_creation_success = particle_populator.FlushParticles();
+			if (ParticleAllocationBase* allocation = particle_populator.GetParticleAllocation())
+			{
+				auto it = tile_chunk_indices.find(std::make_pair(current_chunk_coordinate.x, current_chunk_coordinate.y));
+				if (it == tile_chunk_indices.end())
+				{
+					it = tile_chunk_indices.emplace(std::make_pair(current_chunk_coordinate.x, current_chunk_coordinate.y), tile_chunks.size()).first;
 
-				if (gid == 0)
-					continue;
+					TMTileChunk tile_chunk;
+					tile_chunk.coordinate = current_chunk_coordinate;
+					tile_chunks.push_back(std::move(tile_chunk));
+				}
+				TMTileChunk& tile_chunk = tile_chunks[it->second];
+				tile_chunk.bounding_box = tile_chunk.bounding_box | particle_populator.GetAllocationBoundingBox();
+				tile_chunk.allocations.push_back(allocation);
+			}
+			particle_populator.StartNewAllocation();
+		};
 
-				// search the tile information
-				TiledMap::TileInfo tile_info = tiled_map->FindTileInfo(gid);
-				if (tile_info.tiledata == nullptr)
+		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
+		{
+			size_t count = chunk.tile_indices.size();
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (chunk.tile_indices[i].gid == 0)
 					continue;
 
 				// prepare data for the tile/object
-				glm::ivec2  tile_coord = tile_layer->GetTileCoordinate(chunk, i);
-
+				glm::ivec2 tile_coord = tile_layer->GetTileCoordinate(chunk, i);
 
+				if (tile_chunk_size > 0)
+				{
+					glm::ivec2 chunk_coordinate = { GetChunkCoordinate(tile_coord.x), GetChunkCoordinate(tile_coord.y) };
+					if (!has_current_chunk || chunk_coordinate != current_chunk_coordinate)
+					{
+						FlushTileChunkAllocation();
+						current_chunk_coordinate = chunk_coordinate;
+						has_current_chunk = true;
+					}
+				}
 
+				if (!CreateTileContent(tile_layer, tile_coord, chunk.tile_indices[i], particle_populator, &reference_solver, particle_creation_success))
+					particle_creation_success = false;
+			}
+		}
+		FlushTileChunkAllocation();
 
-				// shu48
-				//
-				// a ce niveau, une particle ne sait pas ou elle est sur la grille
+		// final flush
+		if (particle_creation_success)
+			particle_populator.FlushParticles();
+		// update the bounding box
+		content_bounding_box = particle_populator.GetBoundingBox();
 
+		return true;
+	}
 
+	bool TMLayerInstance::InitializeStreamedTileLayer(TiledMap::TileLayer const* tile_layer, TMObjectReferenceSolver& reference_solver)
+	{
+		streamed_tile_layer = true;
+		streaming_distance = layer->GetPropertyValueFloat("STREAMING_DISTANCE", streaming_distance);
+		streaming_chunk_budget = layer->GetPropertyValueInt("STREAMING_CHUNK_BUDGET", streaming_chunk_budget);
 
+		// one chunk for each chunk of the TiledMap layer (its bounding box is the area of its tiles until it is populated)
+		glm::vec2 tile_size = auto_cast_vector(tile_layer->tile_size);
 
+		tile_chunks.clear();
+		for (TiledMap::TileLayerChunk const& chunk : tile_layer->tile_chunks)
+		{
+			TMTileChunk tile_chunk;
+			tile_chunk.coordinate = chunk.offset / glm::max(chunk.size, glm::ivec2(1, 1));
+			tile_chunk.bounding_box =
+				tile_layer->GetTileBoundingBox(chunk.offset, tile_size, 0, false) |
+				tile_layer->GetTileBoundingBox(chunk.offset + chunk.size - glm::ivec2(1, 1), tile_size, 0, false);
+			tile_chunk.streamed_chunk = &chunk;
+			content_bounding_box = content_bounding_box | tile_chunk.bounding_box;
+			tile_chunks.push_back(std::move(tile_chunk));
+		}
 
+		// XXX : the objects created from tiles are created now, once and for all, so that they exist whatever the camera position
+		//       and their references are solved with the rest of the level. Only the particles of the chunks are streamed.
+		//       The chunks are decoded a first time for that purpose, then their tiles are released.
+		//       Most of the time no tile creates an object : there is no need to decode the whole layer then
+		if (!HasTileObjectFactory())
+			return true;
 
+		size_t chunk_count = tile_layer->tile_chunks.size();
 
+		std::vector<std::vector<TiledMap::Tile>> decoded_chunks(chunk_count);
+		JobManager::GetInstance()->ParallelFor(chunk_count, [tile_layer, &decoded_chunks](size_t i)
+		{
+			TiledMap::TileLayerChunk const& chunk = tile_layer->tile_chunks[i];
+			decoded_chunks[i] = TiledMap::TileLayer::DecodeTileChunk(chunk.encoded_data.c_str(), chunk.size, tile_layer->encoding.c_str(), tile_layer->compression.c_str());
+		});
 
+		TMParticlePopulator particle_populator; // for the particles of the objects (never evicted)
+		if (!particle_populator.Initialize(this))
+			return false;
 
+		for (size_t c = 0; c < chunk_count; ++c)
+		{
+			TiledMap::TileLayerChunk const& chunk = tile_layer->tile_chunks[c];
 
+			size_t count = decoded_chunks[c].size();
+			for (size_t i = 0; i < count; ++i)
+				CreateTileContent(tile_layer, tile_layer->GetTileCoordinate(chunk, i), decoded_chunks[c][i], particle_populator, &reference_solver, false);
+		}
+		particle_populator.FlushParticles();
 
+		return true;
+	}
 
-				box2 particle_box = tile_layer->GetTileBoundingBox(tile_coord, tile_info.tiledata->image_size, particle_flags, false);
+	bool TMLayerInstance::HasTileObjectFactory()
+	{
+		TiledMap::Map const* tiled_map = level_instance->GetTiledMap();
+
+		for (TiledMap::TileSetData const& tileset_data : tiled_map->tilesets)
+			if (tileset_data.tileset != nullptr)
+				for (shared_ptr<TiledMap::TileData> const& tile_data : tileset_data.tileset->tiles)
+					if (tile_data != nullptr && GetObjectFactory(tile_data.get()))
+						return true;
+		return false;
+	}
 
-				// try to create a geometric object from the tile
-				TMObjectFactory factory = GetObjectFactory(tile_info.tiledata);
-				if (factory)
-				{
-					// to avoid the creation of a TMObject, use a wrapper on the properties
-					PropertyOwnerOverride<TiledMap::GeometricObjectTile> tile_object = { nullptr, tile_info.tiledata };
+	void TMLayerInstance::UpdateStreamedTileChunks()
+	{
+		TiledMap::TileLayer const* tile_layer = auto_cast(layer);
+		if (tile_layer == nullptr || particle_layer == nullptr)
+			return;
 
-					// compute an ID base on 'tile_coord'
-					// TiledMap gives positive ID
-					// we want a negative ID to avoid conflicts
-					// for a 32 bits integer
-					// 15 bits for X
-					// 15 bits for Y
-					// 1  unused
-					// 1  bit for sign
+		// XXX : the repetitions of the layer (WRAP_X, WRAP_Y) are not considered for streaming
+		box2 camera_box = chaos::GetBoundingBox(GetLayerCameraOBox());
+		camera_box.position -= offset;
 
-					int int_bit_count = 8 * sizeof(int);
-					int per_component_bit_count = (int_bit_count - 1) / 2;
-					int mask = ~((unsigned int)-1 << per_component_bit_count);
-					int idx = tile_coord.x & mask;
-					int idy = tile_coord.y & mask;
-					int object_id = -1 * (idx | (idy << per_component_bit_count));
+		box2 streaming_box = camera_box;
+		streaming_box.half_size += glm::vec2(streaming_distance, streaming_distance);
 
-					tile_object.id = object_id;
-					tile_object.gid = gid;
-					tile_object.type = tile_info.tiledata->type;
-					tile_object.size = particle_box.half_size * 2.0f;
+		++streaming_update_count;
 
+		loaded_tile_chunk_count = 0;
+		for (TMTileChunk& tile_chunk : tile_chunks)
+		{
+			TiledMap::TileLayerChunk const* chunk = tile_chunk.streamed_chunk;
+			if (chunk == nullptr)
+				continue;
 
-					// shuyyy : should depend on the pivot ???
+			if (Collide(streaming_box, tile_chunk.bounding_box))
+			{
+				tile_chunk.last_use = streaming_update_count;
 
+				// start the decoding
+				if (!tile_chunk.populated && tile_chunk.decoding == nullptr)
+				{
+					shared_ptr<TMTileChunkDecoding> decoding = new TMTileChunkDecoding;
+					tile_chunk.decoding = decoding;
 
-					tile_object.position.x = particle_box.position.x - particle_box.half_size.x;
-					tile_object.position.y = particle_box.position.y - particle_box.half_size.y;
+					// XXX : the job works on copies so that it does not depend on the lifetime of the map
+					auto decode_job = [decoding, encoded_data = chunk->encoded_data, chunk_size = chunk->size, encoding = tile_layer->encoding, compression = tile_layer->compression]()
+					{
+						decoding->tiles = TiledMap::TileLayer::DecodeTileChunk(encoded_data.c_str(), chunk_size, encoding.c_str(), compression.c_str());
+						decoding->done.store(true, boost::memory_order_release);
+					};
+					// a chunk already inside the camera is required now
+					if (Collide(camera_box, tile_chunk.bounding_box))
+						decode_job();
+					else
+						JobManager::GetInstance()->PushJob(std::move(decode_job));
+				}
+			}
+			// populate the chunks whose decoding is over
+			if (tile_chunk.decoding != nullptr && tile_chunk.decoding->done.load(boost::memory_order_acquire))
+				PopulateStreamedTileChunk(tile_layer, tile_chunk);
 
-					// XXX : for player start : but this is not a great idea to process by exception
-					//       We are writing int the fake object properties, not in the 'tile_info.tiledata'
-					//       That means that if 'tile_info.tiledata' already has a BITMAP_NAME property, this does not
-					//       interfere with that (a just in case value)
-					tile_object.CreatePropertyString("BITMAP_NAME", tile_info.tiledata->atlas_key.c_str());
+			if (tile_chunk.populated || tile_chunk.decoding != nullptr)
+				++loaded_tile_chunk_count;
+		}
 
-					TMObject* object = factory(&tile_object, reference_solver);
-					if (object != nullptr)
-						if (ShouldCreateParticleForObject(&tile_object, object))
-							CreateObjectParticles(&tile_object, object, particle_populator);
+		// too many chunks in memory
+		if (streaming_chunk_budget >= 0 && loaded_tile_chunk_count > size_t(streaming_chunk_budget))
+			EvictStreamedTileChunks(loaded_tile_chunk_count - size_t(streaming_chunk_budget));
+	}
 
+	void TMLayerInstance::PopulateStreamedTileChunk(TiledMap::TileLayer const* tile_layer, TMTileChunk& tile_chunk)
+	{
+		assert(tile_chunk.streamed_chunk != nullptr);
+		assert(tile_chunk.decoding != nullptr);
 
-					continue; // while we have a factory, let the concerned object create its particle
-				}
+		shared_ptr<TMTileChunkDecoding> decoding = tile_chunk.decoding;
+		tile_chunk.decoding = nullptr;
 
-				Hotpoint hotpoint = Hotpoint::BOTTOM_LEFT;
+		TMParticlePopulator particle_populator;
+		if (!particle_populator.Initialize(this))
+			return;
 
-				// create a simple particle => as soon as there is an error, stop trying producing particles
-				bool keep_aspect_ratio = true;
+		bool particle_creation_success = true;
 
-				if (particle_creation_success)
-				{
-					particle_creation_success = particle_populator.AddParticle(
-						tile_info.tiledata->atlas_key.c_str(),
-						hotpoint, particle_box,
-						glm::vec4(1.0f, 1.0f, 1.0f, 1.0f),
-						0.0f,
-						particle_flags,
-						gid,
-						keep_aspect_ratio);
-				}
-			}
+		size_t count = decoding->tiles.size();
+		for (size_t i = 0; i < count; ++i)
+		{
+			glm::ivec2 tile_coord = tile_layer->GetTileCoordinate(*tile_chunk.streamed_chunk, i);
+			if (!CreateTileContent(tile_layer, tile_coord, decoding->tiles[i], particle_populator, nullptr, particle_creation_success))
+				particle_creation_success = false;
 		}
-
-		// final flush
 		if (particle_creation_success)
 			particle_populator.FlushParticles();
-		// update the bounding box
-		content_bounding_box = particle_populator.GetBoundingBox();
 
-		return true;
+		tile_chunk.allocations.clear();
+		if (ParticleAllocationBase* allocation = particle_populator.GetParticleAllocation())
+		{
+			tile_chunk.allocations.push_back(allocation);
+			FinalizeParticles(allocation);
+		}
+		tile_chunk.bounding_box = tile_chunk.bounding_box | particle_populator.GetBoundingBox();
+		tile_chunk.populated = true;
+
+		tile_chunk_visibility_dirty = true;
+		particle_grid.SetDirty();
+	}
+
+	void TMLayerInstance::EvictStreamedTileChunks(size_t count)
+	{
+		// the chunks near the camera are never evicted
+		std::vector<TMTileChunk*> candidates;
+		for (TMTileChunk& tile_chunk : tile_chunks)
+			if ((tile_chunk.populated || tile_chunk.decoding != nullptr) && tile_chunk.last_use != streaming_update_count)
+				candidates.push_back(&tile_chunk);
+
+		// the least recently used first
+		count = std::min(count, candidates.size());
+		std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), [](TMTileChunk const* src1, TMTileChunk const* src2)
+		{
+			return src1->last_use < src2->last_use;
+		});
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			TMTileChunk* tile_chunk = candidates[i];
+			for (weak_ptr<ParticleAllocationBase> const& allocation : tile_chunk->allocations)
+				if (allocation != nullptr)
+					allocation->RemoveFromLayer();
+			tile_chunk->allocations.clear();
+			tile_chunk->decoding = nullptr; // a job in progress keeps its own reference
+			tile_chunk->populated = false;
+		}
+		loaded_tile_chunk_count -= count;
+
+		if (count > 0)
+		{
+			tile_chunk_visibility_dirty = true;
+			particle_grid.SetDirty();
+		}
 	}
 
 	// shulayer
@@ -743,9 +1002,18 @@ namespace chaos
 		size_t object_count = objects.size();
 		for (size_t i = 0; i < object_count; ++i)
 			objects[i]->Tick(delta_time);
-		// tick the particles
+		// load the chunks near the camera
+		if (streamed_tile_layer)
+			UpdateStreamedTileChunks();
+		// tick the particles (they may have moved)
 		if (particle_layer != nullptr)
+		{
 			particle_layer->Tick(delta_time);
+
+			ParticleLayerTraitBase* layer_trait = particle_layer->GetLayerTrait();
+			if (layer_trait == nullptr || layer_trait->dynamic_particles)
+				particle_grid.SetDirty();
+		}
 		// tick the child layers
 		for (auto& layer : layer_instances)
 			if (layer != nullptr)
@@ -753,44 +1021,51 @@ namespace chaos
 		return true;
 	}
 
-	int TMLayerInstance::DoDisplay(GPURenderer* renderer, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params)
+	obox2 TMLayerInstance::GetLayerCameraOBox() const
 	{
-		// display this layer particles
-		int result = 0;
-		if (particle_layer != nullptr)
-		{
-			// camera is expressed in world, so is for layer
-			obox2 camera_obox = GetLevelInstance()->GetCameraOBox(0);
-			obox2 initial_camera_obox = GetLevelInstance()->GetInitialCameraOBox(0);
+		// camera is expressed in world, so is for layer
+		obox2 camera_obox = GetLevelInstance()->GetCameraOBox(0);
+		obox2 initial_camera_obox = GetLevelInstance()->GetInitialCameraOBox(0);
 
-			// XXX : we want some layers to appear further or more near the camera
-			//       the displacement_ratio represent how fast this layer is moving relatively to other layers.
-			//       The reference layer is the layer where the 'effective' camera (and so the PlayerStart is)
-			//         => when player goes outside the screen, the camera is updated so that it is still watching the player
-			//         => that why we consider the PlayerStart's layer as the reference
-			//       to simulate other layer's speed, we just create at rendering time 'virtual cameras' (here this is 'final_camera_box')
-			//       We only multiply 'true camera' distance from its initial position by a ratio value
+		// XXX : we want some layers to appear further or more near the camera
+		//       the displacement_ratio represent how fast this layer is moving relatively to other layers.
+		//       The reference layer is the layer where the 'effective' camera (and so the PlayerStart is)
+		//         => when player goes outside the screen, the camera is updated so that it is still watching the player
+		//         => that why we consider the PlayerStart's layer as the reference
+		//       to simulate other layer's speed, we just create at rendering time 'virtual cameras' (here this is 'final_camera_box')
+		//       We only multiply 'true camera' distance from its initial position by a ratio value
 
-			// apply the displacement to the camera
+		// apply the displacement to the camera
 
-			glm::vec2 final_ratio = glm::vec2(1.0f, 1.0f);
+		glm::vec2 final_ratio = glm::vec2(1.0f, 1.0f);
 
-			TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
-			if (reference_layer != nullptr)
-			{
-				if (reference_layer->displacement_ratio.x != 0.0f)
-					final_ratio.x = displacement_ratio.x / reference_layer->displacement_ratio.x;
-				if (reference_layer->displacement_ratio.y != 0.0f)
-					final_ratio.y = displacement_ratio.y / reference_layer->displacement_ratio.y;
+		TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
+		if (reference_layer != nullptr)
+		{
+			if (reference_layer->displacement_ratio.x != 0.0f)
+				final_ratio.x = displacement_ratio.x / reference_layer->displacement_ratio.x;
+			if (reference_layer->displacement_ratio.y != 0.0f)
+				final_ratio.y = displacement_ratio.y / reference_layer->displacement_ratio.y;
 
-			}
+		}
 
-			// shulayer
+		// shulayer
 
-			obox2 final_camera_obox;
-			final_camera_obox.position = initial_camera_obox.position + (camera_obox.position - initial_camera_obox.position) * final_ratio;
-			final_camera_obox.half_size = initial_camera_obox.half_size + (camera_obox.half_size - initial_camera_obox.half_size) * final_ratio;
+		obox2 final_camera_obox;
+		final_camera_obox.position = initial_camera_obox.position + (camera_obox.position - initial_camera_obox.position) * final_ratio;
+		final_camera_obox.half_size = initial_camera_obox.half_size + (camera_obox.half_size - initial_camera_obox.half_size) * final_ratio;
+		return final_camera_obox;
+	}
+
+	int TMLayerInstance::DoDisplay(GPURenderer* renderer, GPUProgramProviderInterface const * uniform_provider, GPURenderParams const& render_params)
+	{
+		// display this layer particles
+		int result = 0;
+		if (particle_layer != nullptr)
+		{
+			obox2 final_camera_obox = GetLayerCameraOBox();
 
+			TMLayerInstance const* reference_layer = level_instance->reference_layer.get();
 
 
 			// shu48
@@ -826,6 +1101,10 @@ namespace chaos
 			final_camera_box.half_size = final_camera_obox.half_size;
 			main_uniform_provider.AddVariable("projection_matrix", CameraTools::GetProjectionMatrix(final_camera_obox));
 
+			// only the tile chunks inside the camera are to be rendered
+			if (tile_chunks.size() > 0)
+				UpdateTileChunkVisibility(chaos::GetBoundingBox(final_camera_obox), start_instance, last_instance, scissor);
+
 			glm::mat4 local_to_world = glm::translate(glm::vec3(offset.x, offset.y, 0.0f));
 
 			// draw instances
@@ -868,6 +1147,64 @@ namespace chaos
 		return result;
 	}
 
+	void TMLayerInstance::UpdateTileChunkVisibility(box2 const& camera_box, glm::ivec2 const& start_instance, glm::ivec2 const& last_instance, RepeatedBoxScissor const& scissor)
+	{
+		// the visibility only changes with the camera or with the chunks (the layer may be displayed several times with the same camera)
+		if (!tile_chunk_visibility_dirty &&
+			camera_box == visibility_camera_box &&
+			offset == visibility_offset &&
+			start_instance == visibility_start_instance &&
+			last_instance == visibility_last_instance)
+			return;
+
+		tile_chunk_visibility_dirty = false;
+		visibility_camera_box = camera_box;
+		visibility_offset = offset;
+		visibility_start_instance = start_instance;
+		visibility_last_instance = last_instance;
+
+		visible_tile_chunk_count = 0;
+		for (TMTileChunk& tile_chunk : tile_chunks)
+		{
+			if (tile_chunk.allocations.size() == 0)
+				continue;
+
+			// search whether any instance of the chunk touches the camera
+			bool visible = false;
+			for (int x = start_instance.x; x < last_instance.x && !visible; ++x)
+			{
+				for (int y = start_instance.y; y < last_instance.y && !visible; ++y)
+				{
+					box2 chunk_box = tile_chunk.bounding_box;
+					chunk_box.position += offset;
+					if (!infinite_bounding_box)
+						chunk_box.position += scissor.GetInstanceOffset(glm::ivec2(x, y));
+					visible = Collide(camera_box, chunk_box);
+				}
+			}
+			// XXX : the GPU buffer of the layer is only regenerated when the set of visible chunks changes
+			bool has_allocation = false;
+			for (weak_ptr<ParticleAllocationBase> const& allocation : tile_chunk.allocations)
+			{
+				if (allocation != nullptr) // the allocation may have been destroyed (see AUTOCLEAN_PARTICLES)
+				{
+					allocation->Show(visible);
+					has_allocation = true;
+				}
+			}
+			if (visible && has_allocation)
+				++visible_tile_chunk_count;
+		}
+	}
+
+	TMParticleGrid const* TMLayerInstance::GetParticleGrid() const
+	{
+		if (particle_layer == nullptr)
+			return nullptr;
+		particle_grid.Update(particle_layer.get());
+		return &particle_grid;
+	}
+
 	size_t TMLayerInstance::GetObjectCount() const
 	{
 		return objects.size();
@@ -3,15 +3,6 @@
 
 namespace chaos
 {
-	// =====================================
-	// TMTriggerCollisionInfo implementation
-	// =====================================
-
-	bool TMTriggerCollisionInfo::FindTrigger(TMTrigger const* trigger) const
-	{
-		return std::find_if(triggers.begin(), triggers.end(), [trigger](weak_ptr<TMTrigger> const& p) {return p.get() == trigger; }) != triggers.end();
-	}
-
 	// =====================================
 	// TMLevelInstance implementation
 	// =====================================
@@ -55,37 +46,77 @@ namespace chaos
 
 	void TMLevelInstance::PurgeCollisionInfo()
 	{
-		size_t count = collision_info.size();
-		for (size_t i = count; i > 0; --i)
+		// XXX : the keys are raw pointers. Remove the entries whose object or trigger has been destroyed before the address can be reused
+		for (auto it = collision_info.begin(); it != collision_info.end();)
 		{
-			size_t index = i - 1;
-			if (collision_info[index].object == nullptr)
+			if (it->second.object == nullptr)
+			{
+				it = collision_info.erase(it);
+				continue;
+			}
+			auto& triggers = it->second.triggers;
+			for (auto trigger_it = triggers.begin(); trigger_it != triggers.end();)
 			{
-				std::swap(collision_info[index], collision_info[collision_info.size() - 1]);
-				collision_info.pop_back();
+				if (trigger_it->second.trigger == nullptr)
+					trigger_it = triggers.erase(trigger_it);
+				else
+					++trigger_it;
 			}
+			++it;
 		}
 	}
 
 	TMTriggerCollisionInfo* TMLevelInstance::FindTriggerCollisionInfo(Object* object)
 	{
-		size_t count = collision_info.size();
-		for (size_t i = 0; i < count ; ++i)
-			if (collision_info[i].object == object)
-				return &collision_info[i];
-		return nullptr;
+		auto it = collision_info.find(object);
+		if (it == collision_info.end())
+			return nullptr;
+		return &it->second;
+	}
+
+	void TMLevelInstance::RebuildObjectBroadPhase()
+	{
+		object_broad_phase.Clear();
+
+		// same order than TMLayerInstanceIterator (layer objects first, then child layers)
+		auto InsertLayerObjects = [this](std::vector<shared_ptr<TMLayerInstance>> const& layers, auto const& insert_func) -> void
+		{
+			for (auto const& layer : layers)
+			{
+				if (layer == nullptr)
+					continue;
+				size_t object_count = layer->GetObjectCount();
+				for (size_t i = 0; i < object_count; ++i)
+				{
+					TMObject* object = layer->GetObject(i);
+					if (object != nullptr)
+						object_broad_phase.InsertObject(object);
+				}
+				insert_func(layer->GetLayerInstances(), insert_func);
+			}
+		};
+		InsertLayerObjects(layer_instances, InsertLayerObjects);
 	}
 
 	void TMLevelInstance::HandleTriggerCollisions(float delta_time, Object* object, box2 const& box, int mask)
 	{
 		TMTriggerCollisionInfo* previous_collisions = FindTriggerCollisionInfo(object);
 
-		TMTriggerCollisionInfo new_collisions;
+		std::vector<weak_ptr<TMTrigger>> new_collisions;
+
+		// the triggers colliding during this call are marked with a new stamp
+		uint64_t collision_stamp = ++trigger_collision_stamp;
 
 		// search all new collisions
-		for (TMTriggerCollisionIterator it = GetTriggerCollisionIterator(box, mask, true) ; it ; ++it)
+		std::vector<TMObject*> candidates;
+		object_broad_phase.CollectObjects(box, mask, true, candidates);
+
+		for (TMObject* candidate : candidates)
 		{
-			TMTrigger& trigger = *it;
+			TMTrigger* trigger_ptr = auto_cast(candidate);
+			if (trigger_ptr == nullptr)
+				continue;
+			TMTrigger& trigger = *trigger_ptr;
 			// trigger only enabled trigger
 			if (!trigger.IsEnabled())
 				continue;
@@ -93,27 +124,37 @@ namespace chaos
 			if (trigger.IsTriggerOnce() && trigger.enter_event_triggered)
 				continue;
 			// collision type
-			CollisionType collision_type = CollisionType::STARTED;
-			if (previous_collisions != nullptr)
-				if (previous_collisions->FindTrigger(&trigger))
-					collision_type = CollisionType::AGAIN;
+			CollisionType collision_type = (previous_collisions != nullptr && previous_collisions->triggers.find(&trigger) != previous_collisions->triggers.end()) ?
+				CollisionType::AGAIN : CollisionType::STARTED;
 			// check for collision (bounding box may change when wanting to go outside)
 			if (trigger.IsCollisionWith(box, collision_type))
-				new_collisions.triggers.push_back(&trigger);
+				new_collisions.push_back(&trigger);
 		}
 
+		// create the record for the object
+		if (previous_collisions == nullptr)
+		{
+			if (new_collisions.size() == 0)
+				return;
+			previous_collisions = &collision_info[object];
+			previous_collisions->object = object;
+		}
 
 		// triggers collisions
-		size_t new_collision_count = new_collisions.triggers.size();
+		size_t new_collision_count = new_collisions.size();
 		for (size_t i = 0; i < new_collision_count; ++i)
 		{
-			TMTrigger* trigger = new_collisions.triggers[i].get();
+			TMTrigger* trigger = new_collisions[i].get();
+			if (trigger == nullptr) // destroyed by a previous event
+				continue;
+
+			// search in previous frame data (and mark the trigger as colliding)
+			auto [it, inserted] = previous_collisions->triggers.try_emplace(trigger);
+			if (inserted)
+				it->second.trigger = trigger;
+			it->second.collision_stamp = collision_stamp;
 
-			// search in previous frame data
-			CollisionType collision_type = CollisionType::STARTED;
-			if (previous_collisions != nullptr)
-				if (previous_collisions->FindTrigger(trigger))
-					collision_type = CollisionType::AGAIN;
+			CollisionType collision_type = (inserted) ? CollisionType::STARTED : CollisionType::AGAIN;
 
 			// trigger event
 			if (trigger->OnCollisionEvent(delta_time, object, collision_type))
@@ -125,29 +166,28 @@ namespace chaos
 			}
 		}
 
-		// triggers end of collisions
-		if (previous_collisions != nullptr)
+		// triggers end of collisions (the triggers of previous frame that have not been marked)
+		std::vector<weak_ptr<TMTrigger>> finished_collisions;
+		for (auto it = previous_collisions->triggers.begin(); it != previous_collisions->triggers.end();)
 		{
-			size_t previous_count = previous_collisions->triggers.size();
-			for (size_t i = 0; i < previous_count; ++i)
+			if (it->second.collision_stamp == collision_stamp)
 			{
-				if (std::find(new_collisions.triggers.begin(), new_collisions.triggers.end(), previous_collisions->triggers[i]) == new_collisions.triggers.end()) // no more colliding
-					previous_collisions->triggers[i]->OnCollisionEvent(delta_time, object, CollisionType::FINISHED);
+				++it;
+				continue;
 			}
+			finished_collisions.push_back(it->second.trigger);
+			it = previous_collisions->triggers.erase(it);
 		}
 
-		// store the record
-		if (previous_collisions != nullptr)
-		{
-			if (new_collisions.triggers.size() == 0)
-				collision_info.erase(std::remove_if(collision_info.begin(), collision_info.end(), [object](TMTriggerCollisionInfo const& info) { return info.object == object; }), collision_info.end());
-			else
-				previous_collisions->triggers = std::move(new_collisions.triggers);
-		}
-		else if(new_collisions.triggers.size() > 0)
+		// remove the record when there is no more collision
+		if (previous_collisions->triggers.size() == 0)
+			collision_info.erase(object);
+
+		for (weak_ptr<TMTrigger> const& finished : finished_collisions)
 		{
-			new_collisions.object = object;
-			collision_info.push_back(std::move(new_collisions));
+			TMTrigger* trigger = finished.get();
+			if (trigger != nullptr)
+				trigger->OnCollisionEvent(delta_time, object, CollisionType::FINISHED); // no more colliding
 		}
 	}
 
@@ -199,6 +239,8 @@ namespace chaos
 		size_t count = layer_instances.size();
 		for (size_t i = 0; i < count; ++i)
 			layer_instances[i]->Tick(delta_time);
+		// objects may have moved or been destroyed
+		object_broad_phase.UpdateAllObjects();
 		// purge collision info for object that may have been destroyed
 		PurgeCollisionInfo();
 		// compute the collisions with the player
@@ -235,6 +277,8 @@ namespace chaos
 			return false;
 		// solve the references
 		reference_solver.SolveReferences(this);
+		// index all objects
+		RebuildObjectBroadPhase();
 		// change the level timeout
 		level_timeout = in_level->GetLevelTimeout();
 		return true;
@@ -540,6 +584,7 @@ namespace chaos
 		if (!LevelInstance::SerializeFromJSON(config))
 			return false;
 		TMTools::SerializeLayersFromJSON(this, config);
+		RebuildObjectBroadPhase(); // objects may have been recreated
 		return true;
 	}
 
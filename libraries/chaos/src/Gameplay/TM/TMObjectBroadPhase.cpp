@@ -0,0 +1,190 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================
+	// TMObjectBroadPhase implementation
+	// =====================================
+
+	box2 TMObjectBroadPhase::GetNodeComputationBox(box2 const& bounding_box)
+	{
+		box2 result = bounding_box;
+		result.half_size = glm::max(result.half_size, glm::vec2(MIN_OBJECT_SIZE * 0.5f));
+		return result;
+	}
+
+	size_t TMObjectBroadPhase::FindProxyIndex(TMObject const* object) const
+	{
+		auto it = proxy_indices.find(object);
+		if (it == proxy_indices.end())
+			return std::numeric_limits<size_t>::max();
+		return it->second;
+	}
+
+	TMObject* TMObjectBroadPhase::GetProxyObject(size_t index, uint64_t collision_mask) const
+	{
+		TMObject* result = proxies[index].object.get();
+		if (result == nullptr)
+			return nullptr;
+		if (collision_mask != 0)
+		{
+			TMLayerInstance const* layer_instance = result->GetLayerInstance();
+			if (layer_instance == nullptr || (layer_instance->GetCollisionMask() & collision_mask) == 0)
+				return nullptr;
+		}
+		return result;
+	}
+
+	void TMObjectBroadPhase::InsertProxyInTree(size_t index)
+	{
+		TMObjectBroadPhaseProxy& proxy = proxies[index];
+		assert(proxy.node == nullptr);
+
+		if (IsGeometryEmpty(proxy.bounding_box))
+			return;
+
+		proxy.node = tree.GetOrCreateNode(GetNodeComputationBox(proxy.bounding_box));
+		if (proxy.node != nullptr)
+			proxy.node->proxies.push_back(index);
+	}
+
+	void TMObjectBroadPhase::RemoveProxyFromTree(size_t index)
+	{
+		TMObjectBroadPhaseProxy& proxy = proxies[index];
+		if (proxy.node == nullptr)
+			return;
+
+		auto it = std::find(proxy.node->proxies.begin(), proxy.node->proxies.end(), index);
+		if (it != proxy.node->proxies.end())
+		{
+			*it = proxy.node->proxies.back();
+			proxy.node->proxies.pop_back();
+		}
+		tree.DeleteNodeIfPossible(proxy.node);
+		proxy.node = nullptr;
+	}
+
+	void TMObjectBroadPhase::RemoveProxy(size_t index)
+	{
+		RemoveProxyFromTree(index);
+		proxy_indices.erase(proxies[index].object_key);
+
+		// move the last proxy into the hole
+		size_t last_index = proxies.size() - 1;
+		if (index != last_index)
+		{
+			TMObjectBroadPhaseProxy& last_proxy = proxies[last_index];
+			if (last_proxy.node != nullptr)
+				std::replace(last_proxy.node->proxies.begin(), last_proxy.node->proxies.end(), last_index, index);
+			proxy_indices[last_proxy.object_key] = index;
+			proxies[index] = std::move(last_proxy);
+		}
+		proxies.pop_back();
+	}
+
+	void TMObjectBroadPhase::UpdateProxy(size_t index, box2 const& bounding_box)
+	{
+		TMObjectBroadPhaseProxy& proxy = proxies[index];
+		if (proxy.bounding_box == bounding_box)
+			return;
+
+		// the proxy stays in the same node : no tree operation
+		if (proxy.node != nullptr && !IsGeometryEmpty(bounding_box))
+		{
+			if (ComputeTreeNodeInfo(GetNodeComputationBox(bounding_box)) == proxy.node->GetNodeInfo())
+			{
+				proxy.bounding_box = bounding_box;
+				return;
+			}
+		}
+		// change node
+		RemoveProxyFromTree(index);
+		proxy.bounding_box = bounding_box;
+		InsertProxyInTree(index);
+	}
+
+	bool TMObjectBroadPhase::InsertObject(TMObject* object)
+	{
+		assert(object != nullptr);
+
+		// already inserted : just update
+		if (FindProxyIndex(object) != std::numeric_limits<size_t>::max())
+			return UpdateObject(object);
+
+		TMObjectBroadPhaseProxy proxy;
+		proxy.object = object;
+		proxy.object_key = object;
+		proxy.bounding_box = object->GetBoundingBox(true);
+		proxy.insertion_order = insertion_counter++;
+
+		size_t index = proxies.size();
+		proxies.push_back(std::move(proxy));
+		proxy_indices[object] = index;
+		InsertProxyInTree(index);
+		return true;
+	}
+
+	bool TMObjectBroadPhase::RemoveObject(TMObject const* object)
+	{
+		size_t index = FindProxyIndex(object);
+		if (index == std::numeric_limits<size_t>::max())
+			return false;
+		RemoveProxy(index);
+		return true;
+	}
+
+	bool TMObjectBroadPhase::UpdateObject(TMObject const* object)
+	{
+		size_t index = FindProxyIndex(object);
+		if (index == std::numeric_limits<size_t>::max())
+			return false;
+		UpdateProxy(index, object->GetBoundingBox(true));
+		return true;
+	}
+
+	void TMObjectBroadPhase::UpdateAllObjects()
+	{
+		for (size_t i = proxies.size(); i > 0; --i) // from end to beginning, because destroyed proxies are replaced by the last one
+		{
+			size_t index = i - 1;
+
+			TMObject const* object = proxies[index].object.get();
+			if (object == nullptr)
+				RemoveProxy(index);
+			else
+				UpdateProxy(index, object->GetBoundingBox(true));
+		}
+	}
+
+	void TMObjectBroadPhase::Clear()
+	{
+		tree.Clear();
+		proxies.clear();
+		proxy_indices.clear();
+		insertion_counter = 0;
+	}
+
+	void TMObjectBroadPhase::CollectObjects(box2 const& box, uint64_t collision_mask, bool open_geometry, std::vector<TMObject*>& result)
+	{
+		std::vector<size_t> indices;
+		tree.ForEachIntersectingNode(box, [this, &box, collision_mask, open_geometry, &indices](node_type* node)
+		{
+			for (size_t index : node->proxies)
+				if (GetProxyObject(index, collision_mask) != nullptr)
+					if (Collide(box, proxies[index].bounding_box, open_geometry))
+						indices.push_back(index);
+		});
+
+		// the order of the tree is not relevant : use the insertion order
+		std::sort(indices.begin(), indices.end(), [this](size_t i1, size_t i2)
+		{
+			return proxies[i1].insertion_order < proxies[i2].insertion_order;
+		});
+
+		result.reserve(result.size() + indices.size());
+		for (size_t index : indices)
+			result.push_back(proxies[index].object.get());
+	}
+
+}; // namespace chaos
@@ -0,0 +1,278 @@
+#include "chaos/ChaosPCH.h"
+#include "chaos/ChaosInternals.h"
+
+namespace chaos
+{
+	// =====================================
+	// TMParticleGrid implementation
+	// =====================================
+
+	void TMParticleGrid::SetCellSize(glm::vec2 const& in_cell_size)
+	{
+		assert(in_cell_size.x > 0.0f && in_cell_size.y > 0.0f);
+		cell_size = in_cell_size;
+		Clear();
+	}
+
+	void TMParticleGrid::Clear()
+	{
+		entries.clear();
+		cells.clear();
+		large_entries.clear();
+		built_layer = nullptr;
+		built_generation = 0;
+		dirty = true;
+	}
+
+	uint64_t TMParticleGrid::GetCellKey(glm::ivec2 const& cell)
+	{
+		return (uint64_t(uint32_t(cell.x)) << 32) | uint64_t(uint32_t(cell.y));
+	}
+
+	size_t TMParticleGrid::GetCellCount(std::pair<glm::ivec2, glm::ivec2> const& cell_range)
+	{
+		glm::ivec2 size = cell_range.second - cell_range.first + glm::ivec2(1, 1);
+		if (size.x <= 0 || size.y <= 0)
+			return 0;
+		return size_t(size.x) * size_t(size.y);
+	}
+
+	std::pair<glm::ivec2, glm::ivec2> TMParticleGrid::GetCellRange(box2 const& box) const
+	{
+		std::pair<glm::vec2, glm::vec2> corners = GetBoxCorners(box);
+
+		std::pair<glm::ivec2, glm::ivec2> result;
+		result.first = glm::ivec2(glm::floor(corners.first / cell_size));
+		result.second = glm::ivec2(glm::floor(corners.second / cell_size)); // XXX : a box touching a cell border is considered inside both cells (required for open geometries)
+		return result;
+	}
+
+	bool TMParticleGrid::GetSweptCells(box2 const& box, glm::vec2 const& delta, std::vector<glm::ivec2>& result, size_t max_count) const
+	{
+		// XXX : the cells covered by the box only change when one of its leading edges crosses a cell border.
+		//       Walk these crossings in time order (DDA) and add the new column or row of cells each time
+		//       (the trailing edges only leave cells that are never entered again)
+
+		std::pair<glm::ivec2, glm::ivec2> cell_range = GetCellRange(box);
+		if (GetCellCount(cell_range) > max_count)
+			return false;
+
+		// the cells at the beginning of the move
+		for (int y = cell_range.first.y; y <= cell_range.second.y; ++y)
+			for (int x = cell_range.first.x; x <= cell_range.second.x; ++x)
+				result.push_back(glm::ivec2(x, y));
+
+		std::pair<glm::vec2, glm::vec2> corners = GetBoxCorners(box);
+
+		glm::ivec2 step = glm::ivec2(0, 0);
+		glm::vec2 next_t = glm::vec2(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+		glm::vec2 delta_t = glm::vec2(0.0f, 0.0f);
+
+		for (int axis = 0; axis < 2; ++axis)
+		{
+			if (delta[axis] > 0.0f)
+			{
+				step[axis] = 1;
+				next_t[axis] = (float(cell_range.second[axis] + 1) * cell_size[axis] - corners.second[axis]) / delta[axis];
+				delta_t[axis] = cell_size[axis] / delta[axis];
+			}
+			else if (delta[axis] < 0.0f)
+			{
+				step[axis] = -1;
+				next_t[axis] = (float(cell_range.first[axis]) * cell_size[axis] - corners.first[axis]) / delta[axis];
+				delta_t[axis] = -cell_size[axis] / delta[axis];
+			}
+		}
+
+		while (true)
+		{
+			// the next crossing
+			int axis = (next_t.x <= next_t.y) ? 0 : 1;
+			int other_axis = 1 - axis;
+
+			float t = next_t[axis];
+			if (t > 1.0f)
+				break;
+			next_t[axis] += delta_t[axis];
+
+			// the new column (or row) entered by the leading edge
+			int line = (step[axis] > 0) ? ++cell_range.second[axis] : --cell_range.first[axis];
+
+			// the cells covered on the other axis at that time
+			int first = int(std::floor((corners.first[other_axis] + delta[other_axis] * t) / cell_size[other_axis]));
+			int last = int(std::floor((corners.second[other_axis] + delta[other_axis] * t) / cell_size[other_axis]));
+
+			if (result.size() + size_t(last - first + 1) > max_count)
+				return false;
+
+			for (int i = first; i <= last; ++i)
+			{
+				glm::ivec2 cell;
+				cell[axis] = line;
+				cell[other_axis] = i;
+				result.push_back(cell);
+			}
+		}
+		return true;
+	}
+
+	std::vector<uint32_t> const* TMParticleGrid::GetCellEntries(glm::ivec2 const& cell) const
+	{
+		auto it = cells.find(GetCellKey(cell));
+		if (it == cells.end())
+			return nullptr;
+		return &it->second;
+	}
+
+	void TMParticleGrid::ComputeEntryCells(TMParticleGridEntry& entry) const
+	{
+		std::pair<glm::ivec2, glm::ivec2> cell_range = GetCellRange(entry.bounding_box);
+		entry.min_cell = cell_range.first;
+		entry.max_cell = cell_range.second;
+		entry.large_entry = (GetCellCount(cell_range) > MAX_CELLS_PER_ENTRY);
+	}
+
+	void TMParticleGrid::InsertEntry(uint32_t entry_index)
+	{
+		TMParticleGridEntry const& entry = entries[entry_index];
+
+		if (entry.large_entry)
+		{
+			large_entries.push_back(entry_index);
+			return;
+		}
+		for (int y = entry.min_cell.y; y <= entry.max_cell.y; ++y)
+			for (int x = entry.min_cell.x; x <= entry.max_cell.x; ++x)
+				cells[GetCellKey(glm::ivec2(x, y))].push_back(entry_index);
+	}
+
+	void TMParticleGrid::RemoveEntry(uint32_t entry_index)
+	{
+		auto RemoveFromVector = [entry_index](std::vector<uint32_t>& v)
+		{
+			auto it = std::find(v.begin(), v.end(), entry_index);
+			if (it != v.end())
+				v.erase(it); // keep the order of the other entries (iteration is deterministic)
+		};
+
+		TMParticleGridEntry const& entry = entries[entry_index];
+
+		if (entry.large_entry)
+		{
+			RemoveFromVector(large_entries);
+			return;
+		}
+		for (int y = entry.min_cell.y; y <= entry.max_cell.y; ++y)
+		{
+			for (int x = entry.min_cell.x; x <= entry.max_cell.x; ++x)
+			{
+				auto it = cells.find(GetCellKey(glm::ivec2(x, y)));
+				if (it != cells.end())
+				{
+					RemoveFromVector(it->second);
+					if (it->second.size() == 0)
+						cells.erase(it);
+				}
+			}
+		}
+	}
+
+	bool TMParticleGrid::HasStructureChanged(ParticleLayerBase const* particle_layer) const
+	{
+		if (particle_layer != built_layer)
+			return true;
+		if (particle_layer != nullptr && particle_layer->GetStructureGeneration() != built_generation)
+			return true;
+		return false;
+	}
+
+	void TMParticleGrid::Rebuild(ParticleLayerBase const* particle_layer)
+	{
+		Clear();
+
+		if (particle_layer == nullptr)
+			return;
+
+		built_layer = particle_layer;
+		built_generation = particle_layer->GetStructureGeneration();
+
+		size_t allocation_count = particle_layer->GetAllocationCount();
+		entries.reserve(particle_layer->GetParticleCount());
+
+		for (size_t i = 0; i < allocation_count; ++i)
+		{
+			ParticleAllocationBase const* allocation = particle_layer->GetAllocation(i);
+			if (allocation == nullptr)
+				continue;
+
+			ParticleConstAccessor<TMParticle> accessor = allocation->GetParticleConstAccessor<TMParticle>();
+
+			size_t particle_count = accessor.GetDataCount();
+			for (size_t j = 0; j < particle_count; ++j)
+			{
+				TMParticleGridEntry entry;
+				entry.allocation_index = uint32_t(i);
+				entry.particle_index = uint32_t(j);
+				entry.bounding_box = accessor[j].bounding_box;
+				ComputeEntryCells(entry);
+
+				entries.push_back(entry);
+				InsertEntry(uint32_t(entries.size() - 1));
+			}
+		}
+	}
+
+	void TMParticleGrid::RelocateMovedParticles(ParticleLayerBase const* particle_layer)
+	{
+		uint32_t entry_index = 0;
+
+		size_t allocation_count = particle_layer->GetAllocationCount();
+		for (size_t i = 0; i < allocation_count; ++i)
+		{
+			ParticleAllocationBase const* allocation = particle_layer->GetAllocation(i);
+			if (allocation == nullptr)
+				continue;
+
+			ParticleConstAccessor<TMParticle> accessor = allocation->GetParticleConstAccessor<TMParticle>();
+
+			size_t particle_count = accessor.GetDataCount();
+			for (size_t j = 0; j < particle_count; ++j, ++entry_index)
+			{
+				TMParticleGridEntry& entry = entries[entry_index];
+
+				box2 const& bounding_box = accessor[j].bounding_box;
+				if (bounding_box == entry.bounding_box)
+					continue;
+
+				TMParticleGridEntry new_entry = entry;
+				new_entry.bounding_box = bounding_box;
+				ComputeEntryCells(new_entry);
+
+				// the particle stays in the same cells : just update the box
+				if (new_entry.min_cell == entry.min_cell && new_entry.max_cell == entry.max_cell && new_entry.large_entry == entry.large_entry)
+				{
+					entry.bounding_box = bounding_box;
+				}
+				// move the particle to its new cells
+				else
+				{
+					RemoveEntry(entry_index);
+					entry = new_entry;
+					InsertEntry(entry_index);
+				}
+			}
+		}
+	}
+
+	void TMParticleGrid::Update(ParticleLayerBase const* particle_layer)
+	{
+		// the allocations have changed : rebuild everything
+		if (HasStructureChanged(particle_layer))
+			Rebuild(particle_layer);
+		// particles may have moved
+		else if (dirty && particle_layer != nullptr)
+			RelocateMovedParticles(particle_layer);
+		dirty = false;
+	}
+
+}; // namespace chaos
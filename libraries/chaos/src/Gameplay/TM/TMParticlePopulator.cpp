@@ -75,6 +75,14 @@ namespace chaos
 		return result;
 	}
 
+	bool TMParticlePopulator::StartNewAllocation()
+	{
+		bool result = FlushParticles();
+		allocation = nullptr; // XXX : the allocation is created lazily with the next flush
+		allocation_bounding_box = box2();
+		return result;
+	}
+
 	bool TMParticlePopulator::AddParticle(char const* bitmap_name, Hotpoint hotpoint, box2 particle_box, glm::vec4 const& color, float rotation, int particle_flags, int gid, bool keep_aspect_ratio)
 	{
 		assert(bitmap_name != nullptr);
@@ -134,6 +142,7 @@ namespace chaos
 
 		// increment the bounding box
 		bounding_box = bounding_box | particle_box;
+		allocation_bounding_box = allocation_bounding_box | particle_box;
 
 		// flush previous particles to make room for the new one
 		if (particle_count == PARTICLE_BUFFER_SIZE)
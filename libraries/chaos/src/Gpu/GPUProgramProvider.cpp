@@ -59,21 +59,92 @@ namespace chaos
 	// GPUProgramProvider implementation
 	//
 
+	/** the number of children that have not been consulted thanks to the binding plans (providers are only used by the rendering thread) */
+	static size_t skipped_children_count = 0;
+
+	size_t GPUProgramProvider::ExtractSkippedChildrenCount()
+	{
+		size_t result = skipped_children_count;
+		skipped_children_count = 0;
+		return result;
+	}
+
 	void GPUProgramProvider::Clear()
 	{
 		children_providers.clear();
+		binding_plan_dirty = true;
 	}
 
 	void GPUProgramProvider::AddProvider(GPUProgramProviderBase * provider)
 	{
 		if (provider != nullptr)
+		{
 			children_providers.push_back(provider);
+			binding_plan_dirty = true;
+		}
+	}
+
+	void GPUProgramProvider::UpdateBindingPlan() const
+	{
+		if (!binding_plan_dirty)
+			return;
+
+		named_children.clear();
+		unnamed_children.clear();
+		for (size_t i = children_providers.size(); i > 0; --i)
+		{
+			size_t index = i - 1;
+			if (char const * name = children_providers[index]->GetHandledName())
+				named_children.emplace_back(std::hash<std::string_view>()(name), index);
+			else
+				unnamed_children.push_back(index);
+		}
+		// sort by hash, then by decreasing index (the order of a linear scan)
+		std::sort(named_children.begin(), named_children.end(), [](auto const & a, auto const & b)
+		{
+			return (a.first != b.first) ? (a.first < b.first) : (a.second > b.second);
+		});
+		binding_plan_dirty = false;
 	}
 
 	bool GPUProgramProvider::DoProcessAction(GPUProgramProviderExecutionData const & execution_data) const
 	{
-		// handle children providers
 		size_t count = children_providers.size();
+
+		// an empty name is handled by any child : use a linear scan
+		char const * searched_name = execution_data.GetSearchedName();
+		if (count >= min_binding_plan_children && !StringTools::IsEmpty(searched_name))
+		{
+			UpdateBindingPlan();
+
+			// the children that may handle this name (in reverse order)
+			size_t hash = std::hash<std::string_view>()(searched_name);
+			auto named_begin = std::lower_bound(named_children.begin(), named_children.end(), hash, [](auto const & a, size_t h) { return a.first < h; });
+			auto named_end = named_begin;
+			while (named_end != named_children.end() && named_end->first == hash)
+				++named_end;
+
+			// merge with the children that may handle any name (both lists are in reverse order)
+			size_t consulted = 0;
+			auto it = named_begin;
+			size_t j = 0;
+			while (it != named_end || j < unnamed_children.size())
+			{
+				size_t index = (j >= unnamed_children.size() || (it != named_end && it->second > unnamed_children[j])) ?
+					(it++)->second :
+					unnamed_children[j++];
+				++consulted;
+				if (children_providers[index]->DoProcessAction(execution_data))
+				{
+					skipped_children_count += (count - index) - consulted; // a linear scan would have consulted all children from the last one down to this one
+					return true;
+				}
+			}
+			skipped_children_count += count - consulted;
+			return false;
+		}
+
+		// handle children providers
 		for (size_t i = count; i > 0; --i)
 		{
 			size_t index = i - 1;
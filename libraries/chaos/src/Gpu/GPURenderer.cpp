@@ -94,6 +94,8 @@ namespace chaos
 
 	void GPURenderer::BeginRenderingFrame()
 	{
+		CHAOS_PROFILE_ZONE("GPURenderer::BeginRenderingFrame");
+
 #if _DEBUG
 		assert(!rendering_started);
 		rendering_started = true;
@@ -107,6 +109,8 @@ namespace chaos
 
 	void GPURenderer::EndRenderingFrame()
 	{
+		CHAOS_PROFILE_ZONE("GPURenderer::EndRenderingFrame");
+
 #if _DEBUG
 		assert(rendering_started);
 		rendering_started = false;
@@ -118,6 +122,8 @@ namespace chaos
 
 		// update the frame rate
 		framerate_counter.Accumulate(1.0f);
+		// update the lookups avoided while binding uniforms
+		skipped_provider_lookups_counter.Accumulate(int(GPUProgramProvider::ExtractSkippedChildrenCount()));
 		// push the frame fence in the command queue if required by some external users
 		if (rendering_fence != nullptr)
 			rendering_fence->CreateGPUFence();
@@ -138,6 +144,11 @@ namespace chaos
 		return vertices_counter.GetCurrentValue();
 	}
 
+	int GPURenderer::GetAverageSkippedProviderLookups() const
+	{
+		return skipped_provider_lookups_counter.GetCurrentValue();
+	}
+
 	GPUFence * GPURenderer::GetCurrentFrameFence()
 	{
 		if (rendering_fence == nullptr)
@@ -157,6 +168,7 @@ namespace chaos
 		framerate_counter.Tick(delta_time);
 		drawcall_counter.Tick(delta_time);
 		vertices_counter.Tick(delta_time);
+		skipped_provider_lookups_counter.Tick(delta_time);
 
 		return true;
 	}
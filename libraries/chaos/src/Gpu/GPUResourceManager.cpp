@@ -142,6 +142,11 @@ namespace chaos
 		return GPUTextureLoader(this).LoadObject(path, name, texture_parameters);
 	}
 
+	shared_ptr<ResourceLoadingHandle> GPUResourceManager::LoadTextureAsync(FilePathParam const & path, char const * name, GenTextureParameters const & texture_parameters)
+	{
+		return GPUTextureLoader(this).LoadObjectAsync(path, name, texture_parameters);
+	}
+
 	GPUProgram * GPUResourceManager::LoadProgram(FilePathParam const & path, char const * name)
 	{
 		return GPUProgramLoader(this).LoadObject(path, name);
@@ -159,6 +164,8 @@ namespace chaos
 
 	bool GPUResourceManager::LoadManager(FilePathParam const & path)
 	{
+		CHAOS_PROFILE_ZONE("GPUResourceManager::LoadManager");
+
 		nlohmann::json json;
 		if (!JSONTools::LoadJSONFile(path, json, LoadFileFlag::RECURSIVE))
 			return true;
@@ -169,8 +176,9 @@ namespace chaos
 	{
 		if (!LoadTexturesFromConfiguration(config))
 			return false;
-		if (!LoadProgramsFromConfiguration(config))
+		if (!LoadProgramsFromConfiguration(config)) // while the textures may still be decoded in background
 			return false;
+		FlushLoadingTasks(); // the materials reference the textures
 		if (!LoadMaterialsFromConfiguration(config))
 			return false;
 		return true;
@@ -178,6 +186,7 @@ namespace chaos
 
 	bool GPUResourceManager::LoadTexturesFromConfiguration(nlohmann::json const * config)
 	{
+		CHAOS_PROFILE_ZONE("GPUResourceManager::LoadTextures");
 		return LoadObjectsFromConfiguration<true>(
 			"textures",
 			config,
@@ -186,6 +195,7 @@ namespace chaos
 
 	bool GPUResourceManager::LoadProgramsFromConfiguration(nlohmann::json const * config)
 	{
+		CHAOS_PROFILE_ZONE("GPUResourceManager::LoadPrograms");
 		return LoadObjectsFromConfiguration<true>(
 			"programs",
 			config,
@@ -194,6 +204,7 @@ namespace chaos
 
 	bool GPUResourceManager::LoadMaterialsFromConfiguration(nlohmann::json const * config)
 	{
+		CHAOS_PROFILE_ZONE("GPUResourceManager::LoadMaterials");
 		GPURenderMaterialLoaderReferenceSolver solver; // finalize the missing references
 
 		bool result = LoadObjectsFromConfiguration<true>(
@@ -29,6 +29,76 @@ namespace chaos
 		});
 	}
 
+	shared_ptr<ResourceLoadingHandle> GPUTextureLoader::LoadObjectAsync(char const* name, nlohmann::json const* json, GenTextureParameters const& parameters) const
+	{
+		// only the textures that reference a file can be decoded in background
+		std::string p;
+		if (manager == nullptr || !JSONTools::GetAttribute(json, "path", p))
+			return new ResourceLoadingHandle(LoadObject(name, json, parameters));
+
+		// same checks than the synchronous loading
+		GPUTextureLoader other_loader = *this;
+		if (!other_loader.CheckResourceName(nullptr, name, json) || !other_loader.CheckResourcePath(FilePathParam(p)))
+			return new ResourceLoadingHandle(nullptr);
+		return other_loader.DoLoadObjectAsync(parameters);
+	}
+
+	shared_ptr<ResourceLoadingHandle> GPUTextureLoader::LoadObjectAsync(FilePathParam const& path, char const* name, GenTextureParameters const& parameters) const
+	{
+		if (manager == nullptr)
+			return new ResourceLoadingHandle(LoadObject(path, name, parameters));
+
+		// same checks than the synchronous loading
+		GPUTextureLoader other_loader = *this;
+		if (!other_loader.CheckResourcePath(path) || !other_loader.CheckResourceName(&path.GetResolvedPath(), name, nullptr))
+			return new ResourceLoadingHandle(nullptr);
+		return other_loader.DoLoadObjectAsync(parameters);
+	}
+
+	shared_ptr<ResourceLoadingHandle> GPUTextureLoader::DoLoadObjectAsync(GenTextureParameters const& parameters) const
+	{
+		assert(manager != nullptr);
+		assert(!resolved_path.empty());
+
+		shared_ptr<ResourceLoadingHandle> result = new ResourceLoadingHandle;
+
+		manager->PushLoadingTask([loader = *this, result, parameters]() -> std::function<void()>
+		{
+			// worker : read and decode the file (the image belongs to the finalization, so that it is released even if the finalization never happens)
+			std::shared_ptr<FIBITMAP> image;
+			if (Buffer<char const> buffer = FileTools::MapFile(loader.resolved_path, LoadFileFlag::NO_ERROR_TRACE))
+				if (FIBITMAP* bitmap = ImageTools::LoadImageFromBuffer(buffer))
+					image = std::shared_ptr<FIBITMAP>(bitmap, FIBITMAPDeleter());
+
+			// owning thread : create the texture
+			return [loader, result, parameters, image]()
+			{
+				GPUTexture* texture = nullptr;
+
+				// another loading may have taken the path or the name in the meantime
+				bool path_used = loader.IsPathAlreadyUsedInManager(loader.resolved_path);
+				bool name_used = !loader.resource_name.empty() && loader.IsNameAlreadyUsedInManager(loader.resource_name.c_str());
+				if (!path_used && !name_used)
+				{
+					texture = (image != nullptr) ?
+						loader.GenTextureObject(image.get(), parameters) :
+						loader.GenTextureObject(FilePathParam(loader.resolved_path), parameters); // not an image (JSON description, skybox ...) : synchronous loading
+
+					// same than LoadObjectHelper(...)
+					if (texture != nullptr)
+					{
+						loader.ApplyNameToLoadedResource(texture);
+						loader.ApplyPathToLoadedResource(texture);
+						if (!StringTools::IsEmpty(texture->GetName()))
+							loader.manager->textures.push_back(texture);
+					}
+				}
+				result->SetResult(texture);
+			};
+		});
+		return result;
+	}
+
 	bool GPUTextureLoader::IsPathAlreadyUsedInManager(FilePathParam const & path) const
 	{
 		return (manager != nullptr && manager->FindTextureByPath(path) != nullptr);
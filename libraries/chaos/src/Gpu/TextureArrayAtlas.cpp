@@ -81,7 +81,10 @@ namespace chaos
 			atlas_count = atlas.atlas_count;
 			dimension = atlas.dimension;
 
-			return DoCopyFolder(&root_folder, &atlas.root_folder);
+			if (!DoCopyFolder(&root_folder, &atlas.root_folder))
+				return false;
+			root_folder.BuildIndices();
+			return true;
 		}
 
 		bool TextureArrayAtlas::DoCopyFolder(FolderInfo * dst_folder_info, FolderInfo const * src_folder_info)
@@ -93,6 +96,7 @@ namespace chaos
 			dst_folder_info->SetName(dst_folder_info->GetName());
 			dst_folder_info->SetTag(src_folder_info->GetTag());
 			// copy bitmaps and characters
+			dst_folder_info->InvalidateIndices();
 			dst_folder_info->bitmaps = src_folder_info->bitmaps;
 			dst_folder_info->fonts   = src_folder_info->fonts;
 			// recursively copy data
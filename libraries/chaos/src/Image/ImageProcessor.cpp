@@ -109,6 +109,97 @@ namespace chaos
 		return nullptr;
 	}
 
+	// ================================================================
+	// Distance transform functions
+	// ================================================================
+
+	/** the squared distance for pixels that have no pixel of the mask in their row or column */
+	static constexpr int64_t DISTANCE_INFINITY = std::numeric_limits<int64_t>::max() / 4;
+
+	/** 1D squared distance transform (lower envelope of parabolas, Felzenszwalb & Huttenlocher). v and z are working buffers of n elements */
+	static void SquaredDistanceTransform1D(int64_t const * f, int64_t * d, int n, int * v, double * z)
+	{
+		// compute the lower envelope of the parabolas rooted at the finite samples
+		int k = -1;
+		for (int q = 0; q < n; ++q)
+		{
+			if (f[q] >= DISTANCE_INFINITY)
+				continue;
+
+			double s = -std::numeric_limits<double>::infinity();
+			while (k >= 0)
+			{
+				int p = v[k];
+				// XXX : numerator and denominator are exact integers. The intersection is never close enough to an integer to give a wrong rounding
+				s = double((f[q] + int64_t(q) * q) - (f[p] + int64_t(p) * p)) / double(2 * (q - p));
+				if (s > z[k])
+					break;
+				--k;
+			}
+			if (k < 0)
+				s = -std::numeric_limits<double>::infinity();
+			v[++k] = q;
+			z[k] = s;
+		}
+
+		// no sample at all
+		if (k < 0)
+		{
+			std::fill(d, d + n, DISTANCE_INFINITY);
+			return;
+		}
+
+		// read the envelope
+		int j = 0;
+		for (int q = 0; q < n; ++q)
+		{
+			while (j < k && z[j + 1] < double(q))
+				++j;
+			int p = v[j];
+			d[q] = int64_t(q - p) * (q - p) + f[p];
+		}
+	}
+
+	/** compute for each pixel the exact squared euclidean distance to the nearest pixel of the mask. O(width.height), columns and rows are processed in parallel */
+	static std::vector<int64_t> ComputeSquaredDistanceField(std::vector<char> const & mask, int width, int height)
+	{
+		std::vector<int64_t> result(size_t(width) * size_t(height), DISTANCE_INFINITY);
+
+		JobManager * job_manager = JobManager::GetInstance();
+
+		// vertical distance for each column (2 scans)
+		job_manager->ParallelFor(size_t(width), [&mask, &result, width, height](size_t x)
+		{
+			int64_t last = -1;
+			for (int y = 0; y < height; ++y)
+			{
+				if (mask[x + size_t(y) * width])
+					last = y;
+				if (last >= 0)
+					result[x + size_t(y) * width] = (y - last) * (y - last);
+			}
+			last = -1;
+			for (int y = height - 1; y >= 0; --y)
+			{
+				if (mask[x + size_t(y) * width])
+					last = y;
+				if (last >= 0)
+					result[x + size_t(y) * width] = std::min(result[x + size_t(y) * width], (last - y) * (last - y));
+			}
+		});
+
+		// combine horizontally for each row
+		job_manager->ParallelFor(size_t(height), [&result, width](size_t y)
+		{
+			std::vector<int64_t> f(result.begin() + y * width, result.begin() + (y + 1) * width);
+			std::vector<int> v(width);
+			std::vector<double> z(width);
+			SquaredDistanceTransform1D(f.data(), &result[y * width], width, v.data(), z.data());
+		});
+
+		return result;
+	}
+
 	// ================================================================
 	// ImageProcessorOutline functions
 	// ================================================================
@@ -151,44 +242,35 @@ namespace chaos
 				PixelConverter::Convert(outline, o);
 				PixelConverter::Convert(empty, e);
 
-				int d2 = distance * distance;
+				int64_t d2 = int64_t(distance) * distance;
+
+				// the pixels to keep
+				std::vector<char> mask(size_t(dest_width) * size_t(dest_height), 0);
+				JobManager::GetInstance()->ParallelFor(size_t(src_desc.height), [this, &src_accessor, &mask, &src_desc, dest_width](size_t src_y)
+				{
+					for (int src_x = 0; src_x < src_desc.width; ++src_x)
+						mask[(src_x + distance) + (src_y + distance) * dest_width] = color_filter.Filter(src_accessor(src_x, int(src_y)));
+				});
+
+				// a pixel is in the outline whenever a kept pixel is at a distance less or equal than 'distance'
+				std::vector<int64_t> distances = ComputeSquaredDistanceField(mask, dest_width, dest_height);
 
 				// all pixels on destination images
-				for (int y = 0; y < dest_height; ++y)
+				JobManager::GetInstance()->ParallelFor(size_t(dest_height), [this, &src_accessor, &dst_accessor, &mask, &distances, &outline, &empty, d2, dest_width](size_t y)
 				{
 					for (int x = 0; x < dest_width; ++x)
 					{
-						int src_x = x - distance;
-						int src_y = y - distance;
-
-						// search whether we must add an outline
-						int min_src_x = std::max(0, src_x - distance);
-						int max_src_x = std::min(src_x + distance, src_desc.width - 1);
-
-						int min_src_y = std::max(0, src_y - distance);
-						int max_src_y = std::min(src_y + distance, src_desc.height - 1);
-
-						bool all_neighboor_empty = true;
-						for (int sy = min_src_y; (sy <= max_src_y) && all_neighboor_empty; ++sy)
-						{
-							for (int sx = min_src_x; (sx <= max_src_x) && all_neighboor_empty; ++sx)
-							{
-								int dx = src_x - sx;
-								int dy = src_y - sy;
-								if (dx * dx + dy * dy <= d2)
-									all_neighboor_empty = !color_filter.Filter(src_accessor(sx, sy));
-							}
-						}
+						size_t index = x + y * dest_width;
 
 						// put the pixel on destination
-						if (all_neighboor_empty)
-							dst_accessor(x, y) = empty;
-						else if (src_x >= 0 && src_x < src_desc.width && src_y >= 0 && src_y < src_desc.height && color_filter.Filter(src_accessor(src_x, src_y)))
-							dst_accessor(x, y) = src_accessor(src_x, src_y);
+						if (distances[index] > d2)
+							dst_accessor(x, int(y)) = empty;
+						else if (mask[index])
+							dst_accessor(x, int(y)) = src_accessor(x - distance, int(y) - distance);
 						else
-							dst_accessor(x, y) = outline;
+							dst_accessor(x, int(y)) = outline;
 					}
-				}
+				});
 			}
 			return result;
 		});
@@ -274,6 +274,101 @@ namespace chaos
 		return ImageDescription();
 	}
 
+	// XXX : the row kernels below work on the raw components of the pixels, with simple loops without branches so that the compiler
+	//       can vectorize them. They give the very same results as PixelConverter::Convert(...)
+
+	/** the layout of the components of a pixel type (supported is false for types that have no kernel) */
+	template<typename PIXEL_TYPE>
+	struct PixelComponentLayout
+	{
+		static constexpr bool supported = false;
+	};
+
+	template<typename COMPONENT_TYPE, int COUNT, int R_INDEX, int G_INDEX, int B_INDEX, int A_INDEX>
+	struct PixelComponentLayoutBase
+	{
+		using component_type = COMPONENT_TYPE;
+
+		static constexpr bool supported = true;
+		static constexpr int count = COUNT;
+		static constexpr int R = R_INDEX;
+		static constexpr int G = G_INDEX;
+		static constexpr int B = B_INDEX;
+		static constexpr int A = A_INDEX; // -1 for no alpha
+	};
+
+	template<> struct PixelComponentLayout<PixelGray> : PixelComponentLayoutBase<unsigned char, 1, 0, 0, 0, -1> {};
+	template<> struct PixelComponentLayout<PixelBGR> : PixelComponentLayoutBase<unsigned char, 3, 2, 1, 0, -1> {};
+	template<> struct PixelComponentLayout<PixelBGRA> : PixelComponentLayoutBase<unsigned char, 4, 2, 1, 0, 3> {};
+	template<> struct PixelComponentLayout<PixelGrayFloat> : PixelComponentLayoutBase<float, 1, 0, 0, 0, -1> {};
+	template<> struct PixelComponentLayout<PixelRGBFloat> : PixelComponentLayoutBase<float, 3, 0, 1, 2, -1> {};
+	template<> struct PixelComponentLayout<PixelRGBAFloat> : PixelComponentLayoutBase<float, 4, 0, 1, 2, 3> {};
+
+	/** convert a line of pixels (the kernel is selected at compile time) */
+	template<typename DST_PIXEL_TYPE, typename SRC_PIXEL_TYPE>
+	static void ConvertPixelLine(DST_PIXEL_TYPE* dst, SRC_PIXEL_TYPE const* src, int width)
+	{
+		using src_layout = PixelComponentLayout<SRC_PIXEL_TYPE>;
+		using dst_layout = PixelComponentLayout<DST_PIXEL_TYPE>;
+
+		if constexpr (std::is_same_v<DST_PIXEL_TYPE, SRC_PIXEL_TYPE>)
+		{
+			memcpy(dst, src, width * sizeof(SRC_PIXEL_TYPE));
+		}
+		else if constexpr (!src_layout::supported || !dst_layout::supported)
+		{
+			for (int c = 0; c < width; ++c)
+				PixelConverter::Convert(dst[c], src[c]);
+		}
+		else
+		{
+			using src_component = typename src_layout::component_type;
+			using dst_component = typename dst_layout::component_type;
+
+			constexpr int SC = src_layout::count;
+			constexpr int DC = dst_layout::count;
+			static_assert(sizeof(SRC_PIXEL_TYPE) == SC * sizeof(src_component));
+			static_assert(sizeof(DST_PIXEL_TYPE) == DC * sizeof(dst_component));
+
+			src_component const* s = reinterpret_cast<src_component const*>(src);
+			dst_component* d = reinterpret_cast<dst_component*>(dst);
+
+			if constexpr (DC == 1 && SC == 1) // gray to gray
+			{
+				for (int i = 0; i < width; ++i)
+					d[i] = PixelComponentConverter::Convert<dst_component>(s[i]);
+			}
+			else if constexpr (DC == 1) // color to gray (average method)
+			{
+				for (int i = 0; i < width; ++i)
+				{
+					src_component const* p = s + i * SC;
+					if constexpr (std::is_same_v<src_component, unsigned char>)
+						d[i] = PixelComponentConverter::Convert<dst_component>((unsigned char)((p[src_layout::R] + p[src_layout::G] + p[src_layout::B]) / 3));
+					else
+						d[i] = PixelComponentConverter::Convert<dst_component>((p[src_layout::R] + p[src_layout::G] + p[src_layout::B]) / 3.0f);
+				}
+			}
+			else // gray or color to color (components are swizzled, alpha is copied or set to opaque)
+			{
+				constexpr dst_component opaque = std::is_same_v<dst_component, float> ? dst_component(1.0f) : dst_component(255);
+
+				for (int i = 0; i < width; ++i)
+				{
+					src_component const* p = s + i * SC;
+					dst_component* q = d + i * DC;
+					q[dst_layout::R] = PixelComponentConverter::Convert<dst_component>(p[src_layout::R]);
+					q[dst_layout::G] = PixelComponentConverter::Convert<dst_component>(p[src_layout::G]);
+					q[dst_layout::B] = PixelComponentConverter::Convert<dst_component>(p[src_layout::B]);
+					if constexpr (dst_layout::A >= 0 && src_layout::A >= 0)
+						q[dst_layout::A] = PixelComponentConverter::Convert<dst_component>(p[src_layout::A]);
+					else if constexpr (dst_layout::A >= 0)
+						q[dst_layout::A] = opaque;
+				}
+			}
+		}
+	}
+
 	//
 	// To copy pixels and make conversions, we have to
 	//
@@ -306,36 +401,23 @@ namespace chaos
 				// normal copy
 				if (image_transform == ImageTransform::NO_TRANSFORM)
 				{
-					if (boost::is_same<dst_pixel_type, src_pixel_type>::value)
-					{
-						for (int l = 0; l < height; ++l) // optimized version using memcopy, if there is no conversion to do
-						{
-							src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
-							dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
-							memcpy(dst_line, src_line, width * sizeof(src_pixel_type));
-						}
-					}
-					else
+					for (int l = 0; l < height; ++l)
 					{
-						for (int l = 0; l < height; ++l)
-						{
-							src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
-							dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
-							for (int c = 0; c < width; ++c)
-								PixelConverter::Convert(dst_line[c], src_line[c]);
-						}
+						src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
+						dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + l);
+						ConvertPixelLine(dst_line, src_line, width);
 					}
 				}
 				// copy with central symetry
-				//   no interest to test if source type and dest types are identical because we cannot use memcpy(...) due to symetry
+				//   the line is converted with the same kernels, then reversed in place
 				else if (image_transform == ImageTransform::CENTRAL_SYMETRY)
 				{
 					for (int l = 0; l < height; ++l)
 					{
 						src_pixel_type const* src_line = &src_acc(src_x, src_y + l);
 						dst_pixel_type		* dst_line = &dst_acc(dst_x, dst_y + height - 1 - l);
-						for (int c = 0; c < width; ++c)
-							PixelConverter::Convert(dst_line[width - 1 - c], src_line[c]);
+						ConvertPixelLine(dst_line, src_line, width);
+						std::reverse(dst_line, dst_line + width);
 					}
 				}
 				else
@@ -491,7 +573,7 @@ namespace chaos
 	}
 
 	// XXX : Lifetime rules are respected (see note at the begining of this file)
-	FIBITMAP * ImageTools::LoadImageFromBuffer(Buffer<char> buffer)
+	FIBITMAP * ImageTools::LoadImageFromBuffer(Buffer<char const> buffer)
 	{
 		FIBITMAP * result = nullptr;
 
@@ -511,7 +593,7 @@ namespace chaos
 
 	FIBITMAP * ImageTools::LoadImageFromFile(FilePathParam const & path)
 	{
-		Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::NO_ERROR_TRACE);
+		Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE);
 		if (buffer == nullptr)
 		{
 			Log::Error("LoadImageFromFile: fail to load image [%s]", path.GetResolvedPath().string().c_str());
@@ -523,7 +605,7 @@ namespace chaos
 	std::vector<FIBITMAP*> ImageTools::LoadMultipleImagesFromFile(FilePathParam const & path, ImageAnimationDescription * anim_description)
 	{
 		// load the image and get multi image
-		Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::NO_ERROR_TRACE);
+		Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE);
 		if (buffer == nullptr)
 		{
 			Log::Error("LoadMultipleImagesFromFile: fail to load image [%s]", path.GetResolvedPath().string().c_str());
@@ -532,7 +614,7 @@ namespace chaos
 		return LoadMultipleImagesFromBuffer(buffer, anim_description);
 	}
 
-	std::vector<FIBITMAP*> ImageTools::LoadMultipleImagesFromBuffer(Buffer<char> buffer, ImageAnimationDescription * anim_description)
+	std::vector<FIBITMAP*> ImageTools::LoadMultipleImagesFromBuffer(Buffer<char const> buffer, ImageAnimationDescription * anim_description)
 	{
 		std::vector<FIBITMAP*> result;
 
@@ -38,6 +38,12 @@ namespace chaos
 		layer->require_GPU_update = true;
 	}
 
+	void ParticleAllocationBase::OnParticleCountChanged()
+	{
+		if (layer != nullptr)
+			++layer->structure_generation;
+	}
+
 	bool ParticleAllocationBase::IsAttachedToLayer() const
 	{
 		return (layer != nullptr);
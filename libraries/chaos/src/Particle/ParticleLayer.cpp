@@ -28,6 +28,7 @@ namespace chaos
 			{
 				allocation->OnRemovedFromLayer();
 				particles_allocations.erase(particles_allocations.begin() + index);
+				++structure_generation;
 				return;
 			}
 		}
@@ -35,9 +36,16 @@ namespace chaos
 
 	bool ParticleLayerBase::DoTick(float delta_time)
 	{
+		CHAOS_PROFILE_ZONE("ParticleLayerBase::DoTick");
+
 		// update the particles themselves
 		if (AreParticlesDynamic())
-			require_GPU_update |= TickAllocations(delta_time);
+		{
+			if (parallel_tick)
+				require_GPU_update |= ParallelTickAllocations(delta_time);
+			else
+				require_GPU_update |= TickAllocations(delta_time);
+		}
 		return true;
 	}
 
@@ -80,6 +88,51 @@ namespace chaos
 		return result;
 	}
 
+	bool ParticleLayerBase::ParallelTickAllocations(float delta_time)
+	{
+		size_t count = particles_allocations.size();
+		if (count == 0)
+			return false;
+
+		// update all allocations in parallel (the buffers are not resized yet)
+		std::vector<size_t> remaining_particles(count, 0);
+		JobManager::GetInstance()->ParallelFor(count, [this, delta_time, &remaining_particles](size_t i)
+		{
+			ParticleAllocationBase* allocation = particles_allocations[i].get();
+			if (allocation == nullptr)
+				return;
+			if (allocation->GetParticleCount() == 0 && allocation->GetDestroyWhenEmpty())
+				return;
+			remaining_particles[i] = UpdateAllocationParticles(delta_time, allocation, parallel_tick_range_size);
+		});
+
+		// resize the buffers and collect the allocations to destroy in the same order than the sequential tick
+		std::vector<ParticleAllocationBase*> to_destroy_allocations;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			ParticleAllocationBase* allocation = particles_allocations[i].get();
+			if (allocation == nullptr)
+				continue;
+			// tick or destroy the allocation
+			bool destroy_allocation = false;
+			if (allocation->GetParticleCount() == 0 && allocation->GetDestroyWhenEmpty())
+				destroy_allocation = true;
+			else
+				destroy_allocation = CommitAllocationParticles(allocation, remaining_particles[i]);
+			// register as an allocation to be destroyed
+			if (destroy_allocation)
+				to_destroy_allocations.push_back(allocation);
+		}
+
+		// handle allocation that wanted to react whenever they become empty
+		size_t empty_count = to_destroy_allocations.size();
+		for (size_t i = 0; i < empty_count; ++i)
+			to_destroy_allocations[i]->RemoveFromLayer();
+
+		return true; // particles have changed ... so must it be for vertices
+	}
+
 	SpawnParticleResult ParticleLayerBase::SpawnParticles(size_t count, bool new_allocation)
 	{
 		ParticleAllocationBase* allocation = nullptr;
@@ -91,6 +144,7 @@ namespace chaos
 			if (allocation == nullptr)
 				return nullptr;
 			particles_allocations.push_back(allocation); // register the allocation
+			++structure_generation;
 		}
 		// get the very first allocation
 		else
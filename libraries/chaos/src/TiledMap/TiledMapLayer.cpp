@@ -263,28 +263,14 @@ namespace chaos
 			return result;
 		}
 
-		bool TileLayer::DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression)
+		std::vector<Tile> TileLayer::DecodeTileChunk(char const* txt, glm::ivec2 const& chunk_size, char const* encoding, char const* compression)
 		{
-			if (element == nullptr)
-				return true;
-
-			// read the data
 			std::vector<Tile> tiles;
-
-			glm::ivec2 chunk_size = size;
-			XMLTools::ReadAttribute(element, "width", chunk_size.x); // for non infinite layer, the size of the chunk is the size of the map
-			XMLTools::ReadAttribute(element, "height", chunk_size.y);
-
-			glm::ivec2 chunk_offset = glm::ivec2(0, 0);
-			XMLTools::ReadAttribute(element, "x", chunk_offset.x);
-			XMLTools::ReadAttribute(element, "y", chunk_offset.y);
+			if (txt == nullptr)
+				return tiles;
 
 			if (StringTools::Stricmp(encoding, "base64") == 0)
 			{
-				char const* txt = element->GetText();
-				if (txt == nullptr)
-					return true;
-
 				if (StringTools::Stricmp(compression, "gzip") == 0)
 				{
 					assert(0);
@@ -324,10 +310,6 @@ namespace chaos
 
 				// XXX : for tiles that have any flags set, we have to work with UNSIGNED int
 
-				char const* txt = element->GetText();
-				if (txt == nullptr)
-					return true;
-
 				size_t count = (size_t)(chunk_size.x * chunk_size.y);
 
 				int i = 0;
@@ -345,6 +327,47 @@ namespace chaos
 						++i;
 				}
 			}
+
+			// decode the ID's and the flags
+			for (Tile& tile : tiles)
+				tile.gid = DecodeTileGID(tile.gid, &tile.flags);
+			return tiles;
+		}
+
+		bool TileLayer::DoLoadTileChunk(tinyxml2::XMLElement const* element, char const* encoding, char const* compression)
+		{
+			if (element == nullptr)
+				return true;
+
+			// read the data
+			std::vector<Tile> tiles;
+
+			glm::ivec2 chunk_size = size;
+			XMLTools::ReadAttribute(element, "width", chunk_size.x); // for non infinite layer, the size of the chunk is the size of the map
+			XMLTools::ReadAttribute(element, "height", chunk_size.y);
+
+			glm::ivec2 chunk_offset = glm::ivec2(0, 0);
+			XMLTools::ReadAttribute(element, "x", chunk_offset.x);
+			XMLTools::ReadAttribute(element, "y", chunk_offset.y);
+
+			if (StringTools::Stricmp(encoding, "base64") == 0 || StringTools::Stricmp(encoding, "csv") == 0)
+			{
+				char const* txt = element->GetText();
+				if (txt == nullptr)
+					return true;
+
+				// keep the chunk encoded : it is to be decoded when required
+				if (streamed)
+				{
+					TileLayerChunk chunk;
+					chunk.size = chunk_size;
+					chunk.offset = chunk_offset;
+					chunk.encoded_data = txt;
+					tile_chunks.push_back(std::move(chunk));
+					return true;
+				}
+				tiles = DecodeTileChunk(txt, chunk_size, encoding, compression);
+			}
 			else // else XML
 			{
 				tiles.reserve(chunk_size.x * chunk_size.y);
@@ -361,14 +384,15 @@ namespace chaos
 
 					child = child->NextSiblingElement("tile");
 				}
+
+				// decode the ID's and the flags
+				for (Tile& tile : tiles)
+					tile.gid = DecodeTileGID(tile.gid, &tile.flags);
 			}
 
 
 			if (tiles.size() != 0)
 			{
-				// decode the ID's and the flags
-				for (Tile& tile : tiles)
-					tile.gid = DecodeTileGID(tile.gid, &tile.flags);
 				// insert a chunk for theses tiles
 				TileLayerChunk chunk;
 				chunk.size = chunk_size;
@@ -385,16 +409,28 @@ namespace chaos
 			if (data == nullptr)
 				return false;
 
-			std::string encoding;
 			XMLTools::ReadAttribute(data, "encoding", encoding);
-
-			std::string compression;
 			XMLTools::ReadAttribute(data, "compression", compression);
 
+			tinyxml2::XMLElement const* chunk = data->FirstChildElement("chunk");
+
+			// XXX : only the chunks of an infinite layer with a text encoding may be streamed.
+			//       The tile flag processors need all the tiles and prevent the streaming
+			streamed = false;
+			if (chunk != nullptr && GetPropertyValueBool("STREAMING", false))
+			{
+				if (StringTools::Stricmp(encoding, "base64") != 0 && StringTools::Stricmp(encoding, "csv") != 0)
+					Log::Warning("TileLayer::DoLoadTileBuffer : layer [%s] cannot be streamed with XML encoding", name.c_str());
+				else if (GetPropertyValueString("TILE_FLAG_PROCESSORS", "").length() > 0)
+					Log::Warning("TileLayer::DoLoadTileBuffer : layer [%s] cannot be streamed with TILE_FLAG_PROCESSORS", name.c_str());
+				else
+					streamed = true;
+			}
+
 			// for non infinite layer
-			DoLoadTileChunk(data, encoding.c_str(), compression.c_str());
+			if (chunk == nullptr)
+				DoLoadTileChunk(data, encoding.c_str(), compression.c_str());
 			// for infinite layer
-			tinyxml2::XMLElement const* chunk = data->FirstChildElement("chunk");
 			while (chunk != nullptr)
 			{
 				DoLoadTileChunk(chunk, encoding.c_str(), compression.c_str());
@@ -423,7 +459,7 @@ namespace chaos
 		{
 			// get the chunk containing the position
 			TileLayerChunk const * chunk = GetTileChunk(pos);
-			if (chunk == nullptr)
+			if (chunk == nullptr || chunk->tile_indices.size() == 0) // the chunk may not be decoded (streamed layer)
 				return {};
 			// get the ID at the given position
 			return chunk->GetTile(pos);
@@ -20,7 +20,7 @@ return_type * Manager::function_name(func_params, bool store_object)\
 
 #define CHAOS_IMPL_MANAGER_LOAD_ALL(function_name, find_function_name, return_type)\
 	CHAOS_IMPL_MANAGER_LOAD(function_name, find_function_name, return_type, FilePathParam const & path, path)\
-	CHAOS_IMPL_MANAGER_LOAD(function_name, find_function_name, return_type, FilePathParam const & path BOOST_PP_COMMA() Buffer<char> buffer, path BOOST_PP_COMMA() buffer)\
+	CHAOS_IMPL_MANAGER_LOAD(function_name, find_function_name, return_type, FilePathParam const & path BOOST_PP_COMMA() Buffer<char const> buffer, path BOOST_PP_COMMA() buffer)\
 	CHAOS_IMPL_MANAGER_LOAD(function_name, find_function_name, return_type, FilePathParam const & path BOOST_PP_COMMA() tinyxml2::XMLDocument const * doc, path BOOST_PP_COMMA() doc)
 
 	CHAOS_IMPL_MANAGER_LOAD_ALL(LoadMap, FindMap, Map);
@@ -50,12 +50,12 @@ return_type constness * Manager::funcname(FilePathParam const & path) constness\
 #define CHAOS_IMPL_MANAGER_DOLOAD(funcname, return_type, member_name)\
 return_type * Manager::funcname(FilePathParam const & path, bool store_object)\
 {\
-	if (Buffer<char> buffer = FileTools::LoadFile(path, LoadFileFlag::ASCII | LoadFileFlag::NO_ERROR_TRACE))\
+	if (Buffer<char const> buffer = FileTools::MapFile(path, LoadFileFlag::NO_ERROR_TRACE))\
 		return funcname(path, buffer, store_object);\
 	Log::Error("Manager::" #funcname ": fail to load [%s]", path.GetResolvedPath().string().c_str());\
 	return nullptr;\
 }\
-return_type * Manager::funcname(FilePathParam const & path, Buffer<char> buffer, bool store_object)\
+return_type * Manager::funcname(FilePathParam const & path, Buffer<char const> buffer, bool store_object)\
 {\
 	return_type * result = nullptr;\
 	tinyxml2::XMLDocument * doc = new tinyxml2::XMLDocument();\
@@ -880,6 +880,8 @@ namespace chaos
 		{
 			assert(glfw_window == glfwGetCurrentContext());
 
+			CHAOS_PROFILE_ZONE("Window::DrawWindow");
+
 			renderer->BeginRenderingFrame();
 
 			// data provider
@@ -1373,6 +1375,9 @@ namespace chaos
 		if (func("System Information", ImGuiSystemInformationObject::GetStaticClass()))
 			return true;
 
+		if (func("Profiler", ImGuiProfilerObject::GetStaticClass()))
+			return true;
+
 		if (func("Window Information", [this]()
 		{
 			ImGuiWindowInformationObject* result = new ImGuiWindowInformationObject;
@@ -47,8 +47,17 @@ namespace chaos
 		}
 	}
 
+	namespace GlobalVariables
+	{
+		CHAOS_GLOBAL_VARIABLE(bool, EnableProfiler, false);
+		CHAOS_GLOBAL_VARIABLE(bool, SynchronousResourceLoading, false);
+	};
+
 	void WindowApplication::RunMessageLoop(LightweightFunction<bool()> loop_condition_func)
 	{
+		if (GlobalVariables::EnableProfiler.Get())
+			Profiler::GetInstance()->SetEnabled(true);
+
 		double t1 = glfwGetTime();
 
 		while (!loop_condition_func || loop_condition_func())
@@ -74,6 +83,7 @@ namespace chaos
 			// internal tick
 			bool tick_result = WithGLFWContext(shared_context, [this, delta_time]()
 			{
+				CHAOS_PROFILE_ZONE("WindowApplication::Tick");
 				return Tick(delta_time);
 			});
 			if (!tick_result) // quit the loop if the current tick method requires so
@@ -93,11 +103,16 @@ namespace chaos
 			{
 				window->WithWindowContext([&window, delta_time, real_delta_time]()
 				{
-					window->TickRenderer(real_delta_time);
-					window->Tick(delta_time);
+					{
+						CHAOS_PROFILE_ZONE("Window::Tick"); // the drawing has its own zone
+						window->TickRenderer(real_delta_time);
+						window->Tick(delta_time);
+					}
 					window->DrawWindow();
 				});
 			});
+			// update the statistics of the profiler
+			Profiler::GetInstance()->EndFrame();
 			// update time
 			t1 = t2;
 		}
@@ -525,6 +540,8 @@ namespace chaos
 		assert(glfwGetCurrentContext() == shared_context);
 
 		// tick the managers
+		if (gpu_resource_manager != nullptr)
+			gpu_resource_manager->ProcessLoadingTasks((max_loading_duration > 0.0f) ? std::optional<float>(max_loading_duration) : std::optional<float>()); // create the resources loaded in background without stalling the frame
 		if (main_clock != nullptr)
 			main_clock->TickClock(delta_time);
 		if (sound_manager != nullptr)
@@ -548,7 +565,9 @@ namespace chaos
 		if (gpu_resource_manager == nullptr)
 			return false;
 		GiveChildConfiguration(gpu_resource_manager.get(), "gpu");
+		gpu_resource_manager->SetAsynchronousLoading(!GlobalVariables::SynchronousResourceLoading.Get()); // decode the images of the initial loading on the workers
 		gpu_resource_manager->StartManager();
+		gpu_resource_manager->SetAsynchronousLoading(false); // later loadings (games, ReloadGPUResources ...) expect their objects to be available immediately
 		// create internal resource
 		if (!gpu_resource_manager->InitializeInternalResources())
 			return false;
@@ -562,6 +581,7 @@ namespace chaos
 
 		JSONTools::GetAttribute(config, "max_tick_duration", max_tick_duration);
 		JSONTools::GetAttribute(config, "forced_tick_duration", forced_tick_duration);
+		JSONTools::GetAttribute(config, "max_loading_duration", max_loading_duration);
 
 		return true;
 	}